@@ -18,7 +18,10 @@ class eAIActionManager: ActionManagerBase
 	protected ref array<ref InventoryLocation>	m_ReservedInventoryLocations;
 	protected ref eAIInventoryActionHandler		m_InventoryActionHandler;
 	protected ref InventoryLocation				m_HandInventoryLocationTest;
-	protected ref TTypeNameActionInputMap		m_RegistredInputsMap;
+	protected ref TTypeNameActionInputMap		m_RegistredInputsMap;  //! Own inputs of this AI, only created for actions it starts (see eAI_GetInput)
+
+	//! One input per input type, shared by all AI and only assigned to actions which don't have an input yet
+	protected static ref TTypeNameActionInputMap	s_eAI_SharedInputs;
 	
 	protected ref ActionData 					m_PendingActionData;
 
@@ -35,30 +38,45 @@ class eAIActionManager: ActionManagerBase
 	
 	void RegisterInputs(PlayerBase player)
 	{
-		if (!m_RegistredInputsMap)
-		{
-			m_RegistredInputsMap = new TTypeNameActionInputMap;
+		if (s_eAI_SharedInputs)
+			return;
 
-			for (int i = 0; i < m_ActionsArray.Count(); i++)
-			{	
-				ActionBase action = m_ActionsArray.Get(i);
-				typename input_type_name = action.GetInputType();
-				ActionInput ai = ActionInput.Cast(m_RegistredInputsMap.Get(input_type_name));
-				if(!ai)
-				{
-					ai = ActionInput.Cast(input_type_name.Spawn());
-					m_RegistredInputsMap.Insert(input_type_name, ai);
-				}
-				action.SetInput(ai);
-			}
-		
-			foreach (auto type, auto ain : m_RegistredInputsMap)
+		s_eAI_SharedInputs = new TTypeNameActionInputMap;
+
+		foreach (ActionBase action: m_ActionsArray)
+		{
+			typename inputType = action.GetInputType();
+			ActionInput sharedInput = s_eAI_SharedInputs.Get(inputType);
+			if (!sharedInput)
 			{
-				ain.eAI_Init(player, this);
+				sharedInput = ActionInput.Cast(inputType.Spawn());
+				sharedInput.eAI_Init(null, null);
+				s_eAI_SharedInputs.Insert(inputType, sharedInput);
 			}
+
+			//! Actions are shared with the local player's action manager on client, don't replace its inputs
+			if (!action.GetInput())
+				action.SetInput(sharedInput);
 		}
 	}
 
+	//! @return this AI's own input of the given type, created on first use
+	ActionInput eAI_GetInput(typename inputType)
+	{
+		if (!m_RegistredInputsMap)
+			m_RegistredInputsMap = new TTypeNameActionInputMap;
+
+		ActionInput input = m_RegistredInputsMap.Get(inputType);
+		if (!input)
+		{
+			input = ActionInput.Cast(inputType.Spawn());
+			input.eAI_Init(m_Player, this);
+			m_RegistredInputsMap.Insert(inputType, input);
+		}
+
+		return input;
+	}
+
 	//------------------------------------------
 	//EVENTS 
 	//------------------------------------------
@@ -280,9 +298,11 @@ class eAIActionManager: ActionManagerBase
 
 	void HandleInputsOnActionStart(ActionBase action)
 	{
+		ActionInput actionInput = eAI_GetInput(action.GetInputType());
+
 		foreach (auto type, auto ain : m_RegistredInputsMap)
 		{
-			if(action.GetInput() == ain)
+			if(ain == actionInput)
 			{
 				ain.OnActionStart();
 			}
@@ -300,6 +320,9 @@ class eAIActionManager: ActionManagerBase
 	
 	void ResetInputsState()
 	{
+		if (!m_RegistredInputsMap)
+			return;
+
 		foreach (auto type, auto ain : m_RegistredInputsMap)
 		{
 			ain.Reset();
@@ -308,6 +331,9 @@ class eAIActionManager: ActionManagerBase
 	
 	void ResetInputsActions()
 	{
+		if (!m_RegistredInputsMap)
+			return;
+
 		foreach (auto type, auto ain : m_RegistredInputsMap)
 		{
 			ain.ActionsSelectReset();
@@ -0,0 +1,91 @@
+/**@class		eAIAgentGrid
+ * @brief		Fine grid of all AI for neighbour queries of eAICommandMove agent avoidance
+ *
+ * Rebuilt from eAIBase::Get at most every REBUILD_INTERVAL when queried, so it's only maintained while AI are moving.
+ * Queries include a margin for movement since the last rebuild and return AI within the exact radius.
+ **/
+class eAIAgentGrid
+{
+	static const float CELL_SIZE = 5.0;
+	static const int CELL_ROW = 8192;  //! Max cells per row, covers maps up to ~40 km
+	static const int REBUILD_INTERVAL = 100;
+	static const float MOVE_MARGIN = 1.0;  //! AI don't move much further than this between rebuilds
+
+	protected static ref map<int, ref array<eAIBase>> s_Grid = new map<int, ref array<eAIBase>>;
+	protected static int s_LastRebuild = -REBUILD_INTERVAL;
+
+	protected static void Rebuild()
+	{
+		s_Grid.Clear();
+
+		int index;
+		eAIBase ai;
+		while (true)
+		{
+			ai = eAIBase.Get(index);
+			if (!ai)
+				break;
+
+			index++;
+
+			if (!ai.IsAlive())
+				continue;
+
+			int cell = GetCell(ai.GetPosition());
+
+			array<eAIBase> cellAI = s_Grid[cell];
+			if (!cellAI)
+			{
+				cellAI = new array<eAIBase>;
+				s_Grid.Insert(cell, cellAI);
+			}
+
+			cellAI.Insert(ai);
+		}
+	}
+
+	//! Collect all living AI within radius of position
+	static void GetNearby(vector position, float radius, notnull array<eAIBase> results)
+	{
+		int time = GetGame().GetTime();
+		if (time - s_LastRebuild >= REBUILD_INTERVAL)
+		{
+			Rebuild();
+			s_LastRebuild = time;
+		}
+
+		float radiusSq = radius * radius;
+		float margin = radius + MOVE_MARGIN;
+
+		int minX = GetCellCoord(position[0] - margin);
+		int maxX = GetCellCoord(position[0] + margin);
+		int minZ = GetCellCoord(position[2] - margin);
+		int maxZ = GetCellCoord(position[2] + margin);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				array<eAIBase> cellAI = s_Grid[x * CELL_ROW + z];
+				if (!cellAI)
+					continue;
+
+				foreach (eAIBase ai: cellAI)
+				{
+					if (ai && vector.DistanceSq(ai.GetPosition(), position) <= radiusSq)
+						results.Insert(ai);
+				}
+			}
+		}
+	}
+
+	static int GetCellCoord(float coord)
+	{
+		return Math.Clamp(Math.Floor(coord / CELL_SIZE), 0, CELL_ROW - 1);
+	}
+
+	static int GetCell(vector position)
+	{
+		return GetCellCoord(position[0]) * CELL_ROW + GetCellCoord(position[2]);
+	}
+};
@@ -24,6 +24,17 @@ class eAICommandMove: ExpansionHumanCommandScript
 	static const int BLOCKED_RIGHT_HITPOSITION = 16;
 	static const int BLOCKED_BACKWARD_HITPOSITION = 17;
 
+	//! Obstacle probe results older than their max age are refreshed on every PROBE_STAGGER-th frame, offset per instance
+	static const int PROBE_STAGGER = 3;
+	static const float PROBE_MAX_AGE = 0.25;
+	static const float PROBE_CHARACTERS_MAX_AGE = 0.05;
+
+	//! Agent-agent avoidance
+	static const float AGENT_RADIUS = 0.35;
+	static const float AGENT_SEARCH_RADIUS = 5.0;
+	static const float AGENT_TIME_HORIZON = 0.5;
+	static const float AGENT_SPEED_FACTOR = 2.0;  //! Approx. m/s per movement speed unit
+
 	static int s_InstanceCount;
 	private int m_InstanceNum;
 
@@ -93,6 +104,16 @@ class eAICommandMove: ExpansionHumanCommandScript
 	private vector m_OverrideWaypoint;
 	private float m_DebugTime;
 
+	private ref eAIObstacleProbe m_ProbeForward;
+	private ref eAIObstacleProbe m_ProbeBackward;
+	private ref eAIObstacleProbe m_ProbeLeft;
+	private ref eAIObstacleProbe m_ProbeRight;
+	private ref eAIObstacleProbe m_ProbeCharacters;
+	private bool m_ProbeCheckBackward;
+	private float m_ProbeTime;
+	private int m_UpdateCount;
+	private ref array<eAIBase> m_NearbyAgents;
+
 	bool m_IsTagWeaponFire;
 	bool m_WeaponFire;
 
@@ -103,6 +124,13 @@ class eAICommandMove: ExpansionHumanCommandScript
 		m_PathFinding = m_Unit.GetPathFinding();
 
 		m_InstanceNum = s_InstanceCount++;
+
+		m_ProbeForward = new eAIObstacleProbe(PROBE_MAX_AGE);
+		m_ProbeBackward = new eAIObstacleProbe(PROBE_MAX_AGE);
+		m_ProbeLeft = new eAIObstacleProbe(PROBE_MAX_AGE);
+		m_ProbeRight = new eAIObstacleProbe(PROBE_MAX_AGE);
+		m_ProbeCharacters = new eAIObstacleProbe(PROBE_CHARACTERS_MAX_AGE);
+		m_NearbyAgents = new array<eAIBase>;
 	}
 
 	void ~eAICommandMove()
@@ -238,6 +266,8 @@ class eAICommandMove: ExpansionHumanCommandScript
 #endif
 
 		m_SpeedUpdateTime += pDt;
+		m_ProbeTime += pDt;
+		m_UpdateCount++;
 
 		vector debug_points[2];
 
@@ -352,8 +382,11 @@ class eAICommandMove: ExpansionHumanCommandScript
 			//! Only check bwd if we are moving bwd, else check fwd
 			if (Math.AbsFloat(m_MovementDirection) >= 135)
 			{
+				SetProbeCheckBackward(true);
 				checkDir = position - 0.5 * fb;
-				blockedBackward = Raycast(position + CHECK_MIN_HEIGHT, checkDir + CHECK_MIN_HEIGHT, backwardPos, outNormal, hitFraction, checkDir + CHECK_MIN_HEIGHT, 0.5, true);
+				blockedBackward = IsAgentBlocking(position, -fb, backwardPos);
+				if (!blockedBackward)
+					blockedBackward = ProbeMovement(m_ProbeBackward, position + CHECK_MIN_HEIGHT, checkDir + CHECK_MIN_HEIGHT, backwardPos, outNormal, hitFraction, checkDir + CHECK_MIN_HEIGHT, 0.5);
 
 				if (!blockedBackward && m_PositionTime > 0.3)
 					blockedBackward = true;
@@ -369,8 +402,11 @@ class eAICommandMove: ExpansionHumanCommandScript
 			}
 			else
 			{
+				SetProbeCheckBackward(false);
 				checkDir = position + 0.5 * fb;
-				blockedForward = Raycast(position + CHECK_MIN_HEIGHT, checkDir + CHECK_MIN_HEIGHT, forwardPos, outNormal, hitFraction, position + fb * m_MovementSpeed + CHECK_MIN_HEIGHT, 1.0, true);
+				blockedForward = IsAgentBlocking(position, fb, forwardPos);
+				if (!blockedForward)
+					blockedForward = ProbeMovement(m_ProbeForward, position + CHECK_MIN_HEIGHT, checkDir + CHECK_MIN_HEIGHT, forwardPos, outNormal, hitFraction, position + fb * m_MovementSpeed + CHECK_MIN_HEIGHT, 1.0);
 
 				if (!blockedForward && m_PositionTime > 0.3)
 					blockedForward = true;
@@ -411,10 +447,10 @@ class eAICommandMove: ExpansionHumanCommandScript
 				vector lr = fb.Perpend();
 				vector checkLeft = position + 0.25 * lr;
 				vector checkRight = position - 0.25 * lr;
-				blockedLeft = Raycast(position + CHECK_MIN_HEIGHT, checkLeft + CHECK_MIN_HEIGHT, leftPos, outNormal, hitFraction, checkDir + lr + CHECK_MIN_HEIGHT, 0.5);
+				blockedLeft = CachedRaycast(m_ProbeLeft, position + CHECK_MIN_HEIGHT, checkLeft + CHECK_MIN_HEIGHT, leftPos, outNormal, hitFraction, checkDir + lr + CHECK_MIN_HEIGHT, 0.5);
 				if (blockedLeft)
 					m_Unit.Expansion_DebugObject_Deferred(BLOCKED_LEFT_HITPOSITION, leftPos, "ExpansionDebugBox_Purple", outNormal);
-				blockedRight = Raycast(position + CHECK_MIN_HEIGHT, checkRight + CHECK_MIN_HEIGHT, rightPos, outNormal, hitFraction, checkDir - lr + CHECK_MIN_HEIGHT, 0.5);
+				blockedRight = CachedRaycast(m_ProbeRight, position + CHECK_MIN_HEIGHT, checkRight + CHECK_MIN_HEIGHT, rightPos, outNormal, hitFraction, checkDir - lr + CHECK_MIN_HEIGHT, 0.5);
 				if (blockedRight)
 					m_Unit.Expansion_DebugObject_Deferred(BLOCKED_RIGHT_HITPOSITION, rightPos, "ExpansionDebugBox_Purple", outNormal);
 
@@ -940,7 +976,162 @@ class eAICommandMove: ExpansionHumanCommandScript
 		return true;
 	}
 
-	private bool Raycast(vector start, vector end, out vector hitPosition, out vector hitNormal, out float hitFraction, vector endRV = vector.Zero, float radiusRV = 0.25, bool includeAI = false)
+	private bool IsStaggerFrame()
+	{
+		return (m_UpdateCount + m_InstanceNum) % PROBE_STAGGER == 0;
+	}
+
+	//! Side probes depend on whether we check fwd or bwd, drop them when that changes
+	private void SetProbeCheckBackward(bool checkBackward)
+	{
+		if (checkBackward == m_ProbeCheckBackward)
+			return;
+
+		m_ProbeCheckBackward = checkBackward;
+		m_ProbeLeft.Invalidate();
+		m_ProbeRight.Invalidate();
+	}
+
+	//! Static obstacles and other characters/creatures in movement direction. AI are handled by IsAgentBlocking beforehand.
+	private bool ProbeMovement(eAIObstacleProbe probe, vector start, vector end, out vector hitPosition, out vector hitNormal, out float hitFraction, vector endRV, float radiusRV)
+	{
+		if (CachedRaycast(probe, start, end, hitPosition, hitNormal, hitFraction, endRV, radiusRV))
+			return true;
+
+		return CachedRaycastCharacters(start, end, hitPosition, hitNormal, hitFraction);
+	}
+
+	//! Raycast against static obstacles, result is reused while position and direction stay within the probe's tolerances
+	private bool CachedRaycast(eAIObstacleProbe probe, vector start, vector end, out vector hitPosition, out vector hitNormal, out float hitFraction, vector endRV = vector.Zero, float radiusRV = 0.25)
+	{
+		vector direction = vector.Direction(start, end).Normalized();
+
+		if (probe.CanReuse(start, direction, m_ProbeTime, IsStaggerFrame()))
+		{
+			hitPosition = probe.m_HitPosition;
+			hitNormal = probe.m_HitNormal;
+			hitFraction = probe.m_HitFraction;
+			return probe.m_Blocked;
+		}
+
+		bool hit = Raycast(start, end, hitPosition, hitNormal, hitFraction, endRV, radiusRV);
+
+		probe.Store(start, direction, m_ProbeTime, hit, hitPosition, hitNormal, hitFraction);
+
+		return hit;
+	}
+
+	//! Sphere cast against players and creatures, short-lived cache as they move. Hits on nearby AI are ignored.
+	private bool CachedRaycastCharacters(vector start, vector end, out vector hitPosition, out vector hitNormal, out float hitFraction)
+	{
+		vector direction = vector.Direction(start, end).Normalized();
+
+		if (m_ProbeCharacters.CanReuse(start, direction, m_ProbeTime, IsStaggerFrame()))
+		{
+			hitPosition = m_ProbeCharacters.m_HitPosition;
+			hitNormal = m_ProbeCharacters.m_HitNormal;
+			hitFraction = m_ProbeCharacters.m_HitFraction;
+			return m_ProbeCharacters.m_Blocked;
+		}
+
+		Object hitObject;
+		bool hit = DayZPhysics.SphereCastBullet(start + direction * 0.125, end, 0.25, PhxInteractionLayers.CHARACTER | PhxInteractionLayers.AI, m_Unit, hitObject, hitPosition, hitNormal, hitFraction);
+		hitFraction = 1.0 - hitFraction;
+
+		//! Hit object is always NULL, match hit position against nearby AI instead
+		if (hit && IsNearAgent(hitPosition))
+			hit = false;
+
+		m_ProbeCharacters.Store(start, direction, m_ProbeTime, hit, hitPosition, hitNormal, hitFraction);
+
+		return hit;
+	}
+
+	/**
+	 * @brief Agent-agent avoidance against nearby AI (velocity obstacle), no raycasts
+	 *
+	 * Blocked if an AI ahead in direction is already within reach or will be within AGENT_TIME_HORIZON at current velocities.
+	 * Also collects m_NearbyAgents for IsNearAgent.
+	 */
+	private bool IsAgentBlocking(vector position, vector direction, out vector hitPosition)
+	{
+		m_NearbyAgents.Clear();
+		eAIAgentGrid.GetNearby(position, AGENT_SEARCH_RADIUS, m_NearbyAgents);
+
+		vector velocity = direction * m_MovementSpeed * AGENT_SPEED_FACTOR;
+		float combinedRadiusSq = 4.0 * AGENT_RADIUS * AGENT_RADIUS;
+
+		foreach (eAIBase agent: m_NearbyAgents)
+		{
+			if (agent == m_Unit || agent.IsInTransport())
+				continue;
+
+			vector agentPosition = agent.GetPosition();
+			vector offset = agentPosition - position;
+
+			//! Different floor
+			if (Math.AbsFloat(offset[1]) > 1.5)
+				continue;
+
+			offset[1] = 0;
+
+			if (vector.Dot(offset, direction) <= 0)
+				continue;
+
+			vector relVelocity = velocity - GetVelocity(agent);
+			relVelocity[1] = 0;
+
+			//! Not closing in
+			float approach = vector.Dot(offset, relVelocity);
+			if (approach <= 0)
+				continue;
+
+			bool blocked = false;
+			if (offset.LengthSq() < combinedRadiusSq)
+			{
+				blocked = true;
+			}
+			else
+			{
+				float t = approach / relVelocity.LengthSq();
+				if (t <= AGENT_TIME_HORIZON)
+				{
+					vector closest = offset - relVelocity * t;
+					if (closest.LengthSq() < combinedRadiusSq)
+						blocked = true;
+				}
+			}
+
+			if (blocked)
+			{
+				hitPosition = agentPosition;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	private bool IsNearAgent(vector position)
+	{
+		float combinedRadiusSq = 4.0 * AGENT_RADIUS * AGENT_RADIUS;
+
+		foreach (eAIBase agent: m_NearbyAgents)
+		{
+			if (agent == m_Unit)
+				continue;
+
+			vector offset = agent.GetPosition() - position;
+			offset[1] = 0;
+
+			if (offset.LengthSq() < combinedRadiusSq)
+				return true;
+		}
+
+		return false;
+	}
+
+	private bool Raycast(vector start, vector end, out vector hitPosition, out vector hitNormal, out float hitFraction, vector endRV = vector.Zero, float radiusRV = 0.25)
 	{
 		if (endRV == vector.Zero)
 			endRV = end;
@@ -965,8 +1156,6 @@ class eAICommandMove: ExpansionHumanCommandScript
 		{
 			Object hitObject;
 			PhxInteractionLayers hit_mask = PhxInteractionLayers.BUILDING | PhxInteractionLayers.DOOR | PhxInteractionLayers.VEHICLE | PhxInteractionLayers.ITEM_LARGE | PhxInteractionLayers.FENCE;
-			if (includeAI)
-				hit_mask |= PhxInteractionLayers.CHARACTER | PhxInteractionLayers.AI;
 			hit = DayZPhysics.SphereCastBullet(start + dir * 0.125, end, 0.25, hit_mask, m_Unit, hitObject, hitPosition, hitNormal, hitFraction);
 			hitFraction = 1.0 - hitFraction;
 		}
@@ -1019,14 +1208,22 @@ class eAICommandMove: ExpansionHumanCommandScript
 		{
 			vector position = m_Transform[3];
 			vector lr = m_Direction.Perpend();
-			vector checkDir = position + 0.5 * m_Direction;
+			vector checkDir;
 			if (Math.AbsFloat(m_MovementDirection) >= 135)
-				checkDir = checkDir * -1.0;
+			{
+				SetProbeCheckBackward(true);
+				checkDir = position - 0.5 * m_Direction;
+			}
+			else
+			{
+				SetProbeCheckBackward(false);
+				checkDir = position + 0.5 * m_Direction;
+			}
 			vector checkLeft = position + 0.25 * lr;
 			vector hitPosition;
 			vector hitNormal;
 			float hitFraction;
-			isBlocked = Raycast(position + CHECK_MIN_HEIGHT, checkLeft + CHECK_MIN_HEIGHT, hitPosition, hitNormal, hitFraction, checkDir + lr + CHECK_MIN_HEIGHT, 0.5);
+			isBlocked = CachedRaycast(m_ProbeLeft, position + CHECK_MIN_HEIGHT, checkLeft + CHECK_MIN_HEIGHT, hitPosition, hitNormal, hitFraction, checkDir + lr + CHECK_MIN_HEIGHT, 0.5);
 			if (isBlocked)
 				blockDistSq = vector.DistanceSq(position, hitPosition);
 		}
@@ -1049,14 +1246,22 @@ class eAICommandMove: ExpansionHumanCommandScript
 		{
 			vector position = m_Transform[3];
 			vector lr = m_Direction.Perpend();
-			vector checkDir = position + 0.5 * m_Direction;
+			vector checkDir;
 			if (Math.AbsFloat(m_MovementDirection) >= 135)
-				checkDir = checkDir * -1.0;
+			{
+				SetProbeCheckBackward(true);
+				checkDir = position - 0.5 * m_Direction;
+			}
+			else
+			{
+				SetProbeCheckBackward(false);
+				checkDir = position + 0.5 * m_Direction;
+			}
 			vector checkRight = position - 0.25 * lr;
 			vector hitPosition;
 			vector hitNormal;
 			float hitFraction;
-			isBlocked = Raycast(position + CHECK_MIN_HEIGHT, checkRight + CHECK_MIN_HEIGHT, hitPosition, hitNormal, hitFraction, checkDir - lr + CHECK_MIN_HEIGHT, 0.5);
+			isBlocked = CachedRaycast(m_ProbeRight, position + CHECK_MIN_HEIGHT, checkRight + CHECK_MIN_HEIGHT, hitPosition, hitNormal, hitFraction, checkDir - lr + CHECK_MIN_HEIGHT, 0.5);
 			if (isBlocked)
 				blockDistSq = vector.DistanceSq(position, hitPosition);
 		}
@@ -0,0 +1,65 @@
+/**@class		eAIObstacleProbe
+ * @brief		Last result of one obstacle probe of eAICommandMove
+ *
+ * The result is reused while the probe origin stays within POSITION_TOLERANCE and its direction within
+ * DIRECTION_TOLERANCE of the probed ones. Once older than the max age, it's only refreshed on the AI's stagger frame
+ * (see eAICommandMove::PROBE_STAGGER) so probes of many AI are spread across frames, but never kept past twice the max age.
+ **/
+class eAIObstacleProbe
+{
+	static const float POSITION_TOLERANCE_SQ = 0.04;  //! 0.2 m
+	static const float DIRECTION_TOLERANCE = 0.985;  //! cos 10°
+
+	float m_MaxAge;
+
+	bool m_IsValid;
+	bool m_Blocked;
+	vector m_Position;
+	vector m_Direction;
+	float m_Time;
+
+	vector m_HitPosition;
+	vector m_HitNormal;
+	float m_HitFraction;
+
+	void eAIObstacleProbe(float maxAge)
+	{
+		m_MaxAge = maxAge;
+	}
+
+	bool CanReuse(vector position, vector direction, float time, bool isStaggerFrame)
+	{
+		if (!m_IsValid)
+			return false;
+
+		float age = time - m_Time;
+		if (age > m_MaxAge * 2.0 || (age > m_MaxAge && isStaggerFrame))
+			return false;
+
+		if (vector.DistanceSq(position, m_Position) > POSITION_TOLERANCE_SQ)
+			return false;
+
+		if (vector.Dot(direction, m_Direction) < DIRECTION_TOLERANCE)
+			return false;
+
+		return true;
+	}
+
+	void Store(vector position, vector direction, float time, bool blocked, vector hitPosition, vector hitNormal, float hitFraction)
+	{
+		m_IsValid = true;
+		m_Position = position;
+		m_Direction = direction;
+		m_Time = time;
+
+		m_Blocked = blocked;
+		m_HitPosition = hitPosition;
+		m_HitNormal = hitNormal;
+		m_HitFraction = hitFraction;
+	}
+
+	void Invalidate()
+	{
+		m_IsValid = false;
+	}
+};
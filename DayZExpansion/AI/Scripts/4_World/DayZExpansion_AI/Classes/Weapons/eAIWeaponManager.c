@@ -241,8 +241,7 @@ class eAIWeaponManager: WeaponManager
 		if( !Class.CastTo(mag2, wpn.GetMagazine(muzzleIndex)) ) 
 			return false;
 		
-		TStringArray mags = new TStringArray();
-		wpn.ConfigGetTextArray("magazines", mags);
+		TStringArray mags = ExpansionConfigCache.GetTextArray(CFG_WEAPONSPATH, wpn.GetType(), "magazines");
 		if (ExpansionStatic.StringArrayContainsIgnoreCase(mags, mag.GetType()))
 			return true;
 		
@@ -0,0 +1,186 @@
+/**
+ * eAIClientUpdateManager.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		eAIClientUpdateManager
+ * @brief		Client side, drives eAIBase::eAI_ClientUpdate for all AI from one per-frame update
+ *
+ * Each AI is updated at an interval depending on distance to the camera and whether it is in front of it,
+ * from 30 Hz for close AI on screen down to 2 Hz for far away or off-screen AI.
+ * AI that don't have their weapon raised only refresh their transform, aiming is skipped.
+ * AI are kept in a compact array (swap remove), each AI knows its index.
+ * With AI tracing enabled, update counts are printed and reset every STATS_INTERVAL seconds.
+ **/
+class eAIClientUpdateManager
+{
+	static const float INTERVAL_NEAR = 0.033333;  //! 30 Hz
+	static const float INTERVAL_MID = 0.1;
+	static const float INTERVAL_FAR = 0.25;
+	static const float INTERVAL_OFFSCREEN = 0.5;
+
+	static const float DISTANCE_NEAR_SQ = 2500.0;  //! 50 m
+	static const float DISTANCE_MID_SQ = 22500.0;  //! 150 m
+	static const float DISTANCE_ALWAYS_VISIBLE_SQ = 100.0;  //! 10 m, closer AI are treated as on screen regardless of view direction
+	static const float OFFSCREEN_DOT = 0.5;  //! cos 60°, AI further from camera direction are treated as off screen
+	static const float STATS_INTERVAL = 10.0;
+
+	protected static ref array<eAIBase> s_AI = new array<eAIBase>;
+	protected static bool s_Running;
+	protected static float s_Time;
+
+	//! Update counts since the last PrintStats, for tuning the intervals above
+	protected static float s_StatsTime;
+	static int s_Updates;
+	static int s_AimingUpdates;
+	static int s_AimingSkipped;
+	static int s_Frames;
+	static int s_MaxCount;
+
+	static void Register(eAIBase ai)
+	{
+		if (ai.m_eAI_ClientUpdateIndex != -1)
+			return;
+
+		ai.m_eAI_ClientUpdateIndex = s_AI.Insert(ai);
+
+		//! Spread first updates
+		ai.m_eAI_NextClientUpdate = s_Time + Math.RandomFloat(0, INTERVAL_NEAR);
+		ai.m_eAI_LastClientUpdate = s_Time;
+
+		if (s_AI.Count() > s_MaxCount)
+			s_MaxCount = s_AI.Count();
+
+		if (!s_Running)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Insert(Update);
+			s_Running = true;
+		}
+	}
+
+	static void Unregister(eAIBase ai)
+	{
+		int index = ai.m_eAI_ClientUpdateIndex;
+		if (index == -1)
+			return;
+
+		ai.m_eAI_ClientUpdateIndex = -1;
+
+		RemoveAt(index);
+	}
+
+	protected static void RemoveAt(int index)
+	{
+		int last = s_AI.Count() - 1;
+		if (index < last)
+		{
+			eAIBase moved = s_AI[last];
+			s_AI[index] = moved;
+			if (moved)
+				moved.m_eAI_ClientUpdateIndex = index;
+		}
+
+		s_AI.Remove(last);
+
+		if (s_AI.Count() == 0 && s_Running)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(Update);
+			s_Running = false;
+		}
+	}
+
+	static void Update(float timeslice)
+	{
+#ifdef DIAG
+		auto trace = EXTrace.Profile(EXTrace.AI, eAIClientUpdateManager);
+#endif
+
+		s_Time += timeslice;
+		s_Frames++;
+
+		vector cameraPos = GetGame().GetCurrentCameraPosition();
+		vector cameraDir = GetGame().GetCurrentCameraDirection();
+
+		int i = 0;
+		while (i < s_AI.Count())
+		{
+			eAIBase ai = s_AI[i];
+
+			//! Deleted without unregistering
+			if (!ai)
+			{
+				RemoveAt(i);
+				continue;
+			}
+
+			if (s_Time >= ai.m_eAI_NextClientUpdate)
+			{
+				float pDt = s_Time - ai.m_eAI_LastClientUpdate;
+				ai.m_eAI_LastClientUpdate = s_Time;
+				ai.m_eAI_NextClientUpdate = s_Time + GetInterval(ai, cameraPos, cameraDir);
+
+				s_Updates++;
+				if (ai.eAI_ClientUpdate(pDt))
+					s_AimingUpdates++;
+				else
+					s_AimingSkipped++;
+			}
+
+			i++;
+		}
+
+		if (EXTrace.AI && s_Time - s_StatsTime >= STATS_INTERVAL)
+		{
+			PrintStats();
+			ResetStats();
+		}
+	}
+
+	static float GetInterval(eAIBase ai, vector cameraPos, vector cameraDir)
+	{
+		vector offset = ai.GetPosition() - cameraPos;
+		float distanceSq = offset.LengthSq();
+
+		if (distanceSq > DISTANCE_ALWAYS_VISIBLE_SQ && vector.Dot(offset.Normalized(), cameraDir) < OFFSCREEN_DOT)
+			return INTERVAL_OFFSCREEN;
+
+		if (distanceSq < DISTANCE_NEAR_SQ)
+			return INTERVAL_NEAR;
+
+		if (distanceSq < DISTANCE_MID_SQ)
+			return INTERVAL_MID;
+
+		return INTERVAL_FAR;
+	}
+
+	static int Count()
+	{
+		return s_AI.Count();
+	}
+
+	static void ResetStats()
+	{
+		s_Updates = 0;
+		s_AimingUpdates = 0;
+		s_AimingSkipped = 0;
+		s_Frames = 0;
+		s_MaxCount = s_AI.Count();
+		s_StatsTime = s_Time;
+	}
+
+	static void PrintStats()
+	{
+		float updatesPerFrame;
+		if (s_Frames > 0)
+			updatesPerFrame = s_Updates / (s_Frames * 1.0);
+
+		EXPrint("[eAIClientUpdateManager] AI: " + s_AI.Count() + " | Max: " + s_MaxCount + " | Frames: " + s_Frames + " | Updates: " + s_Updates + " (" + updatesPerFrame + " per frame) | Aiming: " + s_AimingUpdates + " | Aiming skipped: " + s_AimingSkipped);
+	}
+}
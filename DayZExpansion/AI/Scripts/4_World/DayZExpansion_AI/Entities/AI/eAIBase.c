@@ -159,7 +159,10 @@ class eAIBase: PlayerBase
 
 	ref map<ItemBase, bool> m_eAI_ItemThreatOverride = new map<ItemBase, bool>;
 
-	ref Timer m_eAI_ClientUpdateTimer;
+	//! Client, see eAIClientUpdateManager
+	int m_eAI_ClientUpdateIndex = -1;
+	float m_eAI_NextClientUpdate;
+	float m_eAI_LastClientUpdate;
 
 	void eAIBase()
 	{
@@ -179,10 +182,7 @@ class eAIBase: PlayerBase
 		SetEventMask(EntityEvent.INIT);
 
 		if (GetGame().IsClient())
-		{
-			m_eAI_ClientUpdateTimer = new Timer(CALL_CATEGORY_SYSTEM);
-			m_eAI_ClientUpdateTimer.Run(1.0 / 30.0, this, "eAI_ClientUpdate", NULL, true);
-		}
+			eAIClientUpdateManager.Register(this);
 	}
 
 	static eAIBase Get(int index)
@@ -322,6 +322,8 @@ class eAIBase: PlayerBase
 #endif
 
 		s_AllAI.RemoveItem(this);
+
+		eAIClientUpdateManager.Unregister(this);
 	}
 
 	protected override void EOnInit(IEntity other, int extra)
@@ -684,8 +686,7 @@ class eAIBase: PlayerBase
 		if (GetGame().IsServer() && !IsDamageDestroyed())
 			s_Expansion_AllPlayers.m_OnRemove.Remove(eAI_OnRemovePlayer);
 
-		if (m_eAI_ClientUpdateTimer && m_eAI_ClientUpdateTimer.IsRunning())
-			m_eAI_ClientUpdateTimer.Stop();
+		eAIClientUpdateManager.Unregister(this);
 	}
 
 	override bool IsAI()
@@ -1997,14 +1998,19 @@ class eAIBase: PlayerBase
 		return cmd;
 	}
 
-	void eAI_ClientUpdate()
+	//! Called by eAIClientUpdateManager at an interval depending on distance to camera
+	//! @return false if aiming was skipped
+	bool eAI_ClientUpdate(float pDt)
 	{
-		float pDt = 1.0 / 30.0;
-
 		GetTransform(m_ExTransformPlayer);
 
+		//! CommandHandler doesn't run for AI on client, movement state needs to be fetched here
+		GetMovementState(m_MovementState);
+		if (!m_MovementState.IsRaised())
+			return false;
+
 		if (!eAI_HandleAiming(pDt))
-			return;
+			return true;
 
 		HumanInputController hic = GetInputController();
 		EntityAI entityInHands = GetHumanInventory().GetEntityInHands();
@@ -2014,6 +2020,8 @@ class eAIBase: PlayerBase
 			bool exitIronSights = false;
 			HandleWeapons(pDt, entityInHands, hic, exitIronSights);
 		}
+
+		return true;
 	}
 
 	bool eAI_HandleAiming(float pDt, bool hasLOS = false)
@@ -819,78 +819,35 @@ modded class Hologram
 		
 		if ( object != NULL )
 		{
-			string hasSnapping = "cfgVehicles " + object.GetType() + " ExpansionSnapping";
-			if ( GetGame().ConfigIsExisting( hasSnapping ) )
-			{
-				m_BBCanSnap = true;
-			} else
-			{
-				m_BBCanSnap = false;
-			}
-
-			string typePath = "cfgVehicles " + object.GetType() + " ExpansionSnapping type";
-			if ( GetGame().ConfigIsExisting( typePath ) && m_BBCanSnap )
-			{
-				GetGame().ConfigGetText( typePath, m_BBType );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
-
-			string xSizePath = "cfgVehicles " + object.GetType() + " ExpansionSnapping xSize";
-			if ( GetGame().ConfigIsExisting( xSizePath ) && m_BBCanSnap )
-			{
-				m_BBxSize = GetGame().ConfigGetFloat( xSizePath );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
-
-			string ySizePath = "cfgVehicles " + object.GetType() + " ExpansionSnapping ySize";
-			if ( GetGame().ConfigIsExisting( ySizePath ) && m_BBCanSnap )
-			{
-				m_BBySize = GetGame().ConfigGetFloat( ySizePath );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
-
-			string zSizePath = "cfgVehicles " + object.GetType() + " ExpansionSnapping zSize";
-			if ( GetGame().ConfigIsExisting( zSizePath ) && m_BBCanSnap )
-			{
-				m_BBzSize = GetGame().ConfigGetFloat( zSizePath );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
-
-			string xOffsetPath = "cfgVehicles " + object.GetType() + " ExpansionSnapping xOffset";
-			if ( GetGame().ConfigIsExisting( xOffsetPath ) && m_BBCanSnap )
-			{
-				m_BBxOffset = GetGame().ConfigGetFloat( xOffsetPath );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
-
-			string yOffsetPath = "cfgVehicles " + object.GetType() + " ExpansionSnapping yOffset";
-			if ( GetGame().ConfigIsExisting( yOffsetPath ) && m_BBCanSnap )
-			{
-				m_BByOffset = GetGame().ConfigGetFloat( yOffsetPath );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
+			string type = object.GetType();
+			if ( !ExpansionConfigCache.IsExisting( CFG_VEHICLESPATH, type, "ExpansionSnapping" ) )
+				return;
+
+			if ( !ExpansionConfigCache.IsExisting( CFG_VEHICLESPATH, type, "ExpansionSnapping type" ) )
+				return;
+
+			m_BBType = ExpansionConfigCache.GetText( CFG_VEHICLESPATH, type, "ExpansionSnapping type" );
+
+			m_BBCanSnap = true;
+			m_BBxSize = GetSnappingFloat( type, "xSize" );
+			m_BBySize = GetSnappingFloat( type, "ySize" );
+			m_BBzSize = GetSnappingFloat( type, "zSize" );
+			m_BBxOffset = GetSnappingFloat( type, "xOffset" );
+			m_BByOffset = GetSnappingFloat( type, "yOffset" );
+			m_BBzOffset = GetSnappingFloat( type, "zOffset" );
+		}
+	}
 
-			string zOffsetPath = "cfgVehicles " + object.GetType() + " ExpansionSnapping zOffset";
-			if ( GetGame().ConfigIsExisting( zOffsetPath ) && m_BBCanSnap )
-			{
-				m_BBzOffset = GetGame().ConfigGetFloat( zOffsetPath );
-			} else
-			{
-				m_BBCanSnap = false;
-			}
+	//! Sets m_BBCanSnap to false if the value doesn't exist
+	protected float GetSnappingFloat( string type, string name )
+	{
+		if ( !ExpansionConfigCache.IsExisting( CFG_VEHICLESPATH, type, "ExpansionSnapping " + name ) )
+		{
+			m_BBCanSnap = false;
+			return 0;
 		}
+
+		return ExpansionConfigCache.GetFloat( CFG_VEHICLESPATH, type, "ExpansionSnapping " + name );
 	}
 
 	void GenerateSnappingPositions( array<Object> objects, out array< ref ExpansionSnappingPosition > data )
@@ -914,19 +871,8 @@ modded class Hologram
 
 				snapIdx = 0;
 
-				string typePath = "cfgVehicles " + objects[i].GetType() + " ExpansionSnapping type";
-				string type = "";
-				if ( GetGame().ConfigIsExisting( typePath ) )
-				{
-					GetGame().ConfigGetText( typePath, type );
-				}
-
-				string defaultHidePath = "cfgVehicles " + objects[i].GetType() + " ExpansionSnapping default_hide";
-				array< int > defaultHide = new array< int >;
-				if ( GetGame().ConfigIsExisting( defaultHidePath ) )
-				{
-					GetGame().ConfigGetIntArray( defaultHidePath, defaultHide );
-				}
+				string type = ExpansionConfigCache.GetText( CFG_VEHICLESPATH, objects[i].GetType(), "ExpansionSnapping type" );
+				TIntArray defaultHide = ExpansionConfigCache.GetIntArray( CFG_VEHICLESPATH, objects[i].GetType(), "ExpansionSnapping default_hide" );
 
 				while ( objects[i].MemoryPointExists( "ex_snap_pos_" + snapIdx ) )
 				{
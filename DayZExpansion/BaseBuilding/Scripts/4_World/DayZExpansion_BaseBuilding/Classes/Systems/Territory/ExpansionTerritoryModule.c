@@ -27,6 +27,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 	protected ref map<int, TerritoryFlag> 				m_TerritoryFlags;
 	protected int 										m_NextTerritoryID;
 	protected float										m_TimeSliceCheckPlayer;
+	protected ref map<string, ref TIntArray>			m_PlayerTerritoryIDs;  //! Player UID -> IDs of territories the player is a member of
+	protected ref map<string, ref TIntArray>			m_PlayerInviteIDs;  //! Player UID -> IDs of territories the player is invited to
 	
 	//Client
 	protected ref map<int, ref ExpansionTerritory>		m_Territories;  //! Contains only territories which a client is member of
@@ -50,6 +52,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		m_TerritoryFlags = new map<int, TerritoryFlag>;
 		m_NextTerritoryID = 0;
 		m_TimeSliceCheckPlayer = 0;
+		m_PlayerTerritoryIDs = new map<string, ref TIntArray>;
+		m_PlayerInviteIDs = new map<string, ref TIntArray>;
 		
 		//Client	
 		m_Territories = new map<int, ref ExpansionTerritory>;
@@ -114,40 +118,36 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		EXLogPrint("ExpansionTerritoryModule::OnPlayerConnect - Start uid : " + uid + " m_TerritoryFlags.Count() : " + m_TerritoryFlags.Count());
 		#endif
 		
-		TIntArray toRemove = new TIntArray;
-		
-		foreach (int territoryID, TerritoryFlag currFlag: m_TerritoryFlags)
+		TIntArray territoryIDs = m_PlayerTerritoryIDs[uid];
+		if ( territoryIDs )
 		{
-			if (!currFlag)
-			{
-				toRemove.Insert(territoryID);
-				continue;
-			}
-			
-			ExpansionTerritory territory = currFlag.GetTerritory();
-			if ( !territory )
-				continue;
-
-			#ifdef EXPANSION_TERRITORY_MODULE_DEBUG
-			EXLogPrint("ExpansionTerritoryModule::OnPlayerConnect Current territory : " + territory.GetTerritoryName());
-			#endif
+			//! Copy, as flags which no longer exist get unindexed while iterating
+			TIntArray memberTerritoryIDs = new TIntArray;
+			memberTerritoryIDs.Copy( territoryIDs );
 
-			if ( territory && territory.IsMember( uid ) )
+			foreach (int territoryID: memberTerritoryIDs)
 			{
+				TerritoryFlag currFlag = m_TerritoryFlags.Get( territoryID );
+				if ( !currFlag )
+				{
+					m_TerritoryFlags.Remove( territoryID );
+					UnindexTerritory( territoryID );
+					continue;
+				}
+				
+				ExpansionTerritory territory = currFlag.GetTerritory();
+				if ( !territory )
+					continue;
+
 				#ifdef EXPANSION_TERRITORY_MODULE_DEBUG
 				EXLogPrint("ExpansionTerritoryModule::OnPlayerConnect Found territory : " + territory.GetTerritoryName());
 				#endif
 
-				UpdateClient( territory.GetTerritoryID() );
+				UpdateClient( territoryID );
 				//UpdateClient( territory.GetTerritoryID(), cArgs.Player ); //! Why we call a single update for the connecting player when we update all members anyways?
 			}
 		}
 		
-		for (int j = 0; j < toRemove.Count(); ++j)
-		{
-			m_TerritoryFlags.Remove( toRemove[j] );
-		}
-		
 		//Sync invites
 		SyncPlayerInvitesServer( cArgs.Player );
 		
@@ -427,6 +427,7 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		flag.SetTerritory( newTerritory );
 		
 		m_TerritoryFlags.Insert( m_NextTerritoryID, flag );
+		IndexTerritory( newTerritory );
 		
 		UpdateClient( m_NextTerritoryID );
 		
@@ -620,6 +621,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 			if ( GetExpansionSettings().GetLog().Territory )
 				GetExpansionSettings().GetLog().PrintLog( "[Territory] Player \"" + sender.GetName() + "\" (id=" + playerUID + ")" + " deleted territory " + currentTerritory.GetTerritoryName() + " at " + currentTerritory.GetPosition() );
 			
+			UnindexTerritory( territoryID, currentTerritory );
+
 			//Don't forget to set it as null before to delete, to not do a infinte loop
 			flag.SetTerritory(null);
 
@@ -752,6 +755,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		if ( sender && GetExpansionSettings().GetLog().Territory )
 			GetExpansionSettings().GetLog().PrintLog( "[Territory] Admin \"" + sender.GetName() + "\" (id=" + sender.GetId() + ")" + " deleted territory " + currentTerritory.GetTerritoryName() + " at " + currentTerritory.GetPosition() );
 		
+		UnindexTerritory( territoryID, currentTerritory );
+
 		//Don't forget to set it as null before to delete, to not do a infinte loop
 		flag.SetTerritory( null );
 		if (!flag.ToDelete())
@@ -788,8 +793,13 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		string id = sender.GetIdentityUID();
 		array< ref ExpansionTerritoryInvite > invites = new array< ref ExpansionTerritoryInvite >;
 		
-		foreach (int territoryID, TerritoryFlag flag: m_TerritoryFlags)
+		TIntArray territoryIDs = m_PlayerInviteIDs[id];
+		if ( !territoryIDs )
+			territoryIDs = new TIntArray;
+
+		foreach (int territoryID: territoryIDs)
 		{
+			TerritoryFlag flag = m_TerritoryFlags.Get( territoryID );
 			if ( !flag )
 				continue;
 			
@@ -956,6 +966,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 			ExpansionNotification("STR_EXPANSION_TERRITORY_TITLE", new StringLocaliser("STR_EXPANSION_TERRITORY_ERROR_INVITED", targetPlayer.GetIdentity().GetName())).Error(sender);
 			return;
 		}
+
+		IndexPlayer( m_PlayerInviteIDs, invite.UID, invite.TerritoryID );
 		
 		SyncPlayerInvitesServer(targetPlayer);
 		
@@ -1074,6 +1086,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		
 		territory.RemoveTerritoryInvite( sender.GetId() );
 		territory.AddMember( sender.GetId(), sender.GetName() );
+		UnindexPlayer( m_PlayerInviteIDs, sender.GetId(), territoryID );
+		IndexPlayer( m_PlayerTerritoryIDs, sender.GetId(), territoryID );
 		
 		SyncPlayerInvitesServer( senderPlayer );
 		UpdateClient( territoryID );
@@ -1172,7 +1186,8 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 			return;
 		}
 		
-		territory.RemoveTerritoryInvite( sender.GetId() );		
+		territory.RemoveTerritoryInvite( sender.GetId() );
+		UnindexPlayer( m_PlayerInviteIDs, sender.GetId(), territoryID );
 		SyncPlayerInvitesServer( senderPlayer );
 		//UpdateClient( territoryID );
 		
@@ -1527,6 +1542,7 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 			return;
 		}
 		
+		UnindexPlayer( m_PlayerTerritoryIDs, target.GetID(), territoryID );
 		territory.RemoveMember( target );
 		
 		PlayerBase playerTarget = PlayerBase.GetPlayerByUID( target.GetID() );
@@ -1618,6 +1634,7 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 			return;
 		}
 		
+		UnindexPlayer( m_PlayerTerritoryIDs, senderTerritory.GetID(), territoryID );
 		territory.RemoveMember( senderTerritory );
 		
 		Send_UpdateClient( territoryID, NULL, sender );
@@ -1762,6 +1779,9 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 	// ------------------------------------------------------------
 	bool IsPlayerTerritoryMember( notnull PlayerIdentity identity )
 	{
+		if ( !IsMissionClient() )
+			return m_PlayerTerritoryIDs.Contains( identity.GetId() );
+
 		foreach ( int id, ExpansionTerritory currentTerritory: m_Territories )
 		{
 			if (!currentTerritory)
@@ -1803,24 +1823,9 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 			if (playerUID == "")
 				return 0;
 			
-			int nmb = 0;
-			
-			foreach (int territoryID, TerritoryFlag flag: m_TerritoryFlags)
-			{
-				if (!flag)
-					continue;
-				
-				ExpansionTerritory currTerritory = flag.GetTerritory();
-				if (!currTerritory)
-					continue;
-				
-				if ( currTerritory.IsMember(playerUID) )
-				{
-					nmb++;
-				}
-			}
-			
-			return nmb;
+			TIntArray territoryIDs = m_PlayerTerritoryIDs[playerUID];
+			if (territoryIDs)
+				return territoryIDs.Count();
 		}
 		
 		return 0;
@@ -1858,6 +1863,9 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		
 		m_TerritoryFlags.Insert( territoryID, flag );
 		
+		if ( flag.GetTerritory() )
+			IndexTerritory( flag.GetTerritory() );
+		
 		if ( m_NextTerritoryID <= territoryID )
 		{
 			m_NextTerritoryID = territoryID + 1;
@@ -1883,13 +1891,120 @@ class ExpansionTerritoryModule: CF_ModuleWorld
 		if ( territoryID <= -1 )
 			return;
 		
+		//! Already unindexed if the territory was deleted through the module
+		if ( !m_TerritoryFlags.Contains( territoryID ) )
+			return;
+		
 		m_TerritoryFlags.Remove( territoryID );
+		UnindexTerritory( territoryID );
 		
 		#ifdef EXPANSION_TERRITORY_MODULE_DEBUG
 		EXLogPrint("ExpansionTerritoryModule::RemoveTerritoryFlag - End");
 		#endif
 	}
 	
+	// ------------------------------------------------------------
+	// ExpansionTerritoryModule IndexTerritory
+	// Called on server
+	// Adds all members and invites of the territory to the player UID -> territory IDs index.
+	// ------------------------------------------------------------
+	protected void IndexTerritory( notnull ExpansionTerritory territory )
+	{
+		int territoryID = territory.GetTerritoryID();
+		
+		foreach ( ExpansionTerritoryMember member: territory.GetTerritoryMembers() )
+		{
+			if ( member )
+				IndexPlayer( m_PlayerTerritoryIDs, member.GetID(), territoryID );
+		}
+		
+		foreach ( ExpansionTerritoryInvite invite: territory.GetTerritoryInvites() )
+		{
+			if ( invite )
+				IndexPlayer( m_PlayerInviteIDs, invite.UID, territoryID );
+		}
+	}
+	
+	// ------------------------------------------------------------
+	// ExpansionTerritoryModule UnindexTerritory
+	// Called on server
+	// Without territory (e.g. flag destructor, when the territory is already gone), the whole index is searched for the ID.
+	// ------------------------------------------------------------
+	protected void UnindexTerritory( int territoryID, ExpansionTerritory territory = null )
+	{
+		if ( territory )
+		{
+			foreach ( ExpansionTerritoryMember member: territory.GetTerritoryMembers() )
+			{
+				if ( member )
+					UnindexPlayer( m_PlayerTerritoryIDs, member.GetID(), territoryID );
+			}
+			
+			foreach ( ExpansionTerritoryInvite invite: territory.GetTerritoryInvites() )
+			{
+				if ( invite )
+					UnindexPlayer( m_PlayerInviteIDs, invite.UID, territoryID );
+			}
+			
+			return;
+		}
+		
+		UnindexAll( m_PlayerTerritoryIDs, territoryID );
+		UnindexAll( m_PlayerInviteIDs, territoryID );
+	}
+	
+	protected static void IndexPlayer( map<string, ref TIntArray> index, string uid, int territoryID )
+	{
+		TIntArray territoryIDs = index[uid];
+		if ( !territoryIDs )
+		{
+			territoryIDs = new TIntArray;
+			index.Insert( uid, territoryIDs );
+		}
+		
+		if ( territoryIDs.Find( territoryID ) == -1 )
+			territoryIDs.Insert( territoryID );
+	}
+	
+	protected static void UnindexPlayer( map<string, ref TIntArray> index, string uid, int territoryID )
+	{
+		TIntArray territoryIDs = index[uid];
+		if ( !territoryIDs )
+			return;
+		
+		territoryIDs.RemoveItemUnOrdered( territoryID );
+		
+		if ( territoryIDs.Count() == 0 )
+			index.Remove( uid );
+	}
+	
+	protected static void UnindexAll( map<string, ref TIntArray> index, int territoryID )
+	{
+		TStringArray emptied = new TStringArray;
+		
+		foreach ( string uid, TIntArray territoryIDs: index )
+		{
+			territoryIDs.RemoveItemUnOrdered( territoryID );
+			if ( territoryIDs.Count() == 0 )
+				emptied.Insert( uid );
+		}
+		
+		foreach ( string emptiedUID: emptied )
+		{
+			index.Remove( emptiedUID );
+		}
+	}
+	
+	// ------------------------------------------------------------
+	// ExpansionTerritoryModule GetPlayerTerritoryIDs
+	// Called on server
+	// Returns IDs of all territories the player is a member of, or NULL if none. Don't modify the returned array.
+	// ------------------------------------------------------------
+	TIntArray GetPlayerTerritoryIDs( string playerUID )
+	{
+		return m_PlayerTerritoryIDs[playerUID];
+	}
+	
 	// ------------------------------------------------------------
 	// Expansion IsInsideOwnTerritory
 	// Can be called on client or server
@@ -44,9 +44,14 @@ class ExpansionChatSettingsV1: ExpansionChatSettingsBase
  **/
 class ExpansionChatSettings: ExpansionChatSettingsBase
 {
-	static const int VERSION = 2;
+	static const int VERSION = 3;
 	
 	ref ExpansionChatColors ChatColors;
+
+	//! Server, per player flood protection: up to MessageBurstLimit messages at once, refilling at MessageRateLimit messages per second.
+	//! Set MessageBurstLimit to 0 to disable
+	int MessageBurstLimit;
+	float MessageRateLimit;
 	
 	[NonSerialized()]
 	private bool m_IsLoaded;
@@ -134,6 +139,8 @@ class ExpansionChatSettings: ExpansionChatSettingsBase
 #endif
 
 		ChatColors = s.ChatColors;
+		MessageBurstLimit = s.MessageBurstLimit;
+		MessageRateLimit = s.MessageRateLimit;
 
 		ExpansionChatSettingsBase sb = s;
 		CopyInternal( sb );
@@ -214,6 +221,12 @@ class ExpansionChatSettings: ExpansionChatSettingsBase
 					JsonFileLoader<ExpansionChatSettings>.JsonLoadFile(EXPANSION_CHAT_SETTINGS, this);
 				}
 
+				if (settingsBase.m_Version < 3)
+				{
+					MessageBurstLimit = settingsDefault.MessageBurstLimit;
+					MessageRateLimit = settingsDefault.MessageRateLimit;
+				}
+
 				//! Copy over old settings that haven't changed
 				CopyInternal(settingsBase);
 
@@ -268,6 +281,9 @@ class ExpansionChatSettings: ExpansionChatSettingsBase
 		EnablePartyChat = true;
 #endif
 		EnableTransportChat = true;
+
+		MessageBurstLimit = 5;
+		MessageRateLimit = 0.5;
 		
 		ChatColors.Update();
 	}
@@ -12,31 +12,151 @@
 
 /**@class		ExpansionGlobalChatModule
  * @brief		This class handle global chat
+ *
+ * Server side, each message is serialized once and the same RPC is sent to every recipient of the channel
+ * (party members come from a cached list of online identities the party keeps up to date on join/leave).
+ * Senders are rate limited per UID, and chat log lines are queued and written once per LOG_FLUSH_INTERVAL
+ * so a flood of messages doesn't open the log file for each of them.
  **/
 
 [CF_RegisterModule(ExpansionGlobalChatModule)]
 class ExpansionGlobalChatModule: CF_ModuleWorld
 {
+	static const int LOG_FLUSH_INTERVAL = 1000;
+
 #ifdef EXPANSIONMODGROUPS
 	protected ref ExpansionPartyModule m_PartyModule;
 #endif
 
+	//! Server
+	protected ref map<string, ref ExpansionTokenBucket> m_RateLimits;
+	protected ref array<PlayerIdentity> m_Recipients;
+	protected ref array<string> m_LogLines;
+	protected ref array<string> m_AdminLogLines;
+	protected bool m_LogFlushScheduled;
+	protected int m_DroppedMessages;
+
 	// ------------------------------------------------------------
 	void ExpansionGlobalChatModule()
 	{
 		auto trace = EXTrace.Start(ExpansionTracing.CHAT, this);
 
 		GetPermissionsManager().RegisterPermission( "Admin.Chat" );
+
+		m_RateLimits = new map<string, ref ExpansionTokenBucket>;
+		m_Recipients = new array<PlayerIdentity>;
+		m_LogLines = new array<string>;
+		m_AdminLogLines = new array<string>;
 	}
 	
 	override void OnInit()
 	{
 		super.OnInit();
 
+		EnableClientDisconnect();
+		EnableMissionFinish();
+
 		Expansion_EnableRPCManager();
 		Expansion_RegisterBothRPC("RPC_AddChatMessage");
 	}
 
+	override void OnClientDisconnect(Class sender, CF_EventArgs args)
+	{
+		super.OnClientDisconnect(sender, args);
+
+		auto cArgs = CF_EventPlayerDisconnectedArgs.Cast(args);
+
+		m_RateLimits.Remove(cArgs.UID);
+	}
+
+	override void OnMissionFinish(Class sender, CF_EventArgs args)
+	{
+		super.OnMissionFinish(sender, args);
+
+		if (m_LogFlushScheduled)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(FlushLog);
+			FlushLog();
+		}
+
+		m_RateLimits.Clear();
+	}
+
+	// ------------------------------------------------------------
+	//! Server, returns false if the sender exceeded the chat rate limit
+	protected bool CheckRateLimit(string uid)
+	{
+		auto settings = GetExpansionSettings().GetChat();
+		if (settings.MessageBurstLimit <= 0)
+			return true;
+
+		ExpansionTokenBucket bucket;
+		if (!m_RateLimits.Find(uid, bucket))
+		{
+			bucket = new ExpansionTokenBucket(settings.MessageBurstLimit, settings.MessageRateLimit);
+			m_RateLimits.Insert(uid, bucket);
+		}
+		else
+		{
+			//! Settings may have been changed at runtime
+			bucket.SetRate(settings.MessageBurstLimit, settings.MessageRateLimit);
+		}
+
+		return bucket.TryConsume();
+	}
+
+	// ------------------------------------------------------------
+	//! Server, send the same RPC to all recipients
+	protected void Send(ExpansionScriptRPC rpc, array<PlayerIdentity> recipients, Object target = null)
+	{
+		foreach (PlayerIdentity identity: recipients)
+		{
+			if (identity)
+				rpc.Expansion_Send(target, true, identity);
+		}
+	}
+
+	// ------------------------------------------------------------
+	//! Server, queue a chat log line, lines are written by FlushLog
+	protected void QueueLog(string line)
+	{
+		m_LogLines.Insert(ExpansionStatic.GetISOTime() + " " + line);
+		m_AdminLogLines.Insert(line);
+
+		ScheduleLogFlush();
+	}
+
+	protected void ScheduleLogFlush()
+	{
+		if (!m_LogFlushScheduled)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(FlushLog, LOG_FLUSH_INTERVAL);
+			m_LogFlushScheduled = true;
+		}
+	}
+
+	// ------------------------------------------------------------
+	void FlushLog()
+	{
+		m_LogFlushScheduled = false;
+
+		GetExpansionSettings().GetLog().PrintLogLines(m_LogLines);
+
+		foreach (string line: m_AdminLogLines)
+		{
+			GetGame().AdminLog(line);
+		}
+
+		if (m_DroppedMessages > 0)
+		{
+			GetExpansionSettings().GetLog().PrintLog("[Chat] Dropped " + m_DroppedMessages + " messages of players exceeding the rate limit");
+			m_DroppedMessages = 0;
+		}
+
+		m_LogLines.Clear();
+		m_AdminLogLines.Clear();
+	}
+
 	// ------------------------------------------------------------
 	void RPC_AddChatMessage(PlayerIdentity sender, Object target, ParamsReadContext ctx)
 	{
@@ -59,7 +179,22 @@ class ExpansionGlobalChatModule: CF_ModuleWorld
 		
 		if ( IsMissionHost() )
 		{
-			PlayerBase player = PlayerBase.GetPlayerByUID(sender.GetId());
+			string biuid = sender.GetId();
+
+			//! Admin channel is exempt so admins can always step in during a flood
+			if (data.param1 != ExpansionChatChannels.CCAdmin && !CheckRateLimit(biuid))
+			{
+				if (GetExpansionSettings().GetLog().Chat)
+				{
+					m_DroppedMessages++;
+					ScheduleLogFlush();
+				}
+
+				EXTrace.Print(EXTrace.CHAT, this, "Dropping message of " + biuid + " (rate limit)");
+				return;
+			}
+
+			PlayerBase player = PlayerBase.GetPlayerByUID(biuid);
 			bool canSendMessage;
 			string channelName = "";
 			
@@ -98,7 +233,6 @@ class ExpansionGlobalChatModule: CF_ModuleWorld
 			if ( canSendMessage )
 			{
 				data.param2 = sender.GetName();
-				string biuid = sender.GetId();
 
 				if ( GetGame().IsMultiplayer() )
 				{
@@ -108,11 +242,14 @@ class ExpansionGlobalChatModule: CF_ModuleWorld
 					if (vehicle)
 					{
 						//! Only send RPC to vehicle crew
+						m_Recipients.Clear();
 						set<Human> crew = vehicle.Expansion_GetVehicleCrew();
 						foreach (Human crewMember: crew)
 						{
-							rpc.Expansion_Send(vehicle, true, crewMember.GetIdentity());
+							m_Recipients.Insert(crewMember.GetIdentity());
 						}
+
+						Send(rpc, m_Recipients, vehicle);
 					}
 				#ifdef EXPANSIONMODGROUPS
 					else if (partyID >= 0)
@@ -122,15 +259,7 @@ class ExpansionGlobalChatModule: CF_ModuleWorld
 						//! Only send RPC to party players
 						ExpansionPartyData party = player.Expansion_GetParty();
 						if (party)
-						{
-							array<ref ExpansionPartyPlayerData> players = party.GetPlayers();
-							foreach (ExpansionPartyPlayerData partyMember: players)
-							{
-								PlayerBase partyPlayer = partyMember.Player;
-								if (partyPlayer && partyPlayer.GetIdentity())
-									rpc.Expansion_Send(true, partyPlayer.GetIdentity());
-							}
-						}
+							Send(rpc, party.GetOnlineIdentities());
 					}
 				#endif
 					else
@@ -143,8 +272,7 @@ class ExpansionGlobalChatModule: CF_ModuleWorld
 				// Uses similar format as vanilla direct chat log
 				if ( GetExpansionSettings().GetLog().Chat )
 				{
-					GetExpansionSettings().GetLog().PrintLog( "[Chat - " + channelName + "](\"" + data.param2 + "\"(id=" + biuid + ")): " + data.param3 );
-					GetGame().AdminLog( "[Chat - " + channelName + "](\"" + data.param2 + "\"(id=" + biuid + ")): " + data.param3 );
+					QueueLog( "[Chat - " + channelName + "](\"" + data.param2 + "\"(id=" + biuid + ")): " + data.param3 );
 				}
 			}
 		} else
@@ -0,0 +1,432 @@
+/**
+ * ExpansionConfigCache.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+//! Memoised config values of one class, see ExpansionConfigCache
+class ExpansionConfigCacheEntry
+{
+	string m_Path;  //! "<root> <className>"
+	bool m_Exists;
+
+	//! Created on first use, most classes only ever have one or two kinds of values looked up
+	ref map<string, bool> m_Existing;
+	ref map<string, int> m_Types;
+	ref map<string, string> m_Texts;
+	ref map<string, float> m_Floats;
+	ref map<string, int> m_Ints;
+	ref map<string, ref TStringArray> m_TextArrays;
+	ref map<string, ref TIntArray> m_IntArrays;
+	ref map<string, bool> m_KindOf;
+
+	ref TStringArray m_Hierarchy;  //! Lowercase class names from this class up to the root, built on first use
+
+	void ExpansionConfigCacheEntry(string path)
+	{
+		m_Path = path;
+		m_Exists = GetGame().ConfigIsExisting(path);
+	}
+}
+
+/**@class		ExpansionConfigCache
+ * @brief		Memoises config lookups (CfgVehicles, CfgWeapons, ...) per class
+ *
+ * Class names and attribute names are case insensitive like the config itself and are stored lowercase,
+ * so each class has exactly one entry no matter how callers spell it. After the first lookup of a value
+ * every further lookup is a map lookup instead of a string-concatenated engine config query.
+ * Config does not change at runtime, so entries are never invalidated.
+ *
+ * @note Arrays returned by GetTextArray/GetIntArray/GetHierarchy are shared, don't modify them.
+ **/
+class ExpansionConfigCache
+{
+	static const int MAX_HIERARCHY_DEPTH = 32;
+
+	protected static ref map<string, ref ExpansionConfigCacheEntry> s_Entries = new map<string, ref ExpansionConfigCacheEntry>;
+	protected static ref map<string, string> s_Roots = new map<string, string>;
+	protected static ref TStringArray s_RootCandidates = {CFG_VEHICLESPATH, CFG_WEAPONSPATH, CFG_MAGAZINESPATH, CFG_AMMO, "CfgNonAIVehicles"};
+
+	static int s_Hits;
+	static int s_Misses;
+
+	/**
+	 * @brief Get the memo of the given class, creating it if needed
+	 * @param root Config root, e.g. CFG_VEHICLESPATH
+	 */
+	static ExpansionConfigCacheEntry GetEntry(string root, string className)
+	{
+		string path = root + " " + className;
+		path.ToLower();
+
+		ExpansionConfigCacheEntry entry = s_Entries[path];
+		if (!entry)
+		{
+			entry = new ExpansionConfigCacheEntry(path);
+			s_Entries.Insert(path, entry);
+		}
+
+		return entry;
+	}
+
+	//! @return Config root (CfgVehicles, CfgWeapons, CfgMagazines, CfgAmmo or CfgNonAIVehicles) the class is defined in, or empty string
+	static string GetRoot(string className)
+	{
+		string key = className;
+		key.ToLower();
+
+		string root;
+		if (s_Roots.Find(key, root))
+		{
+			s_Hits++;
+			return root;
+		}
+
+		s_Misses++;
+
+		foreach (string candidate: s_RootCandidates)
+		{
+			if (GetEntry(candidate, className).m_Exists)
+			{
+				root = candidate;
+				break;
+			}
+		}
+
+		s_Roots.Insert(key, root);
+
+		return root;
+	}
+
+	static bool IsExisting(string root, string className)
+	{
+		return GetEntry(root, className).m_Exists;
+	}
+
+	//! @param attribute Path below the class, e.g. "ExpansionSnapping xSize"
+	static bool IsExisting(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+		if (!entry.m_Exists)
+			return false;
+
+		string key = attribute;
+		key.ToLower();
+
+		if (entry.m_Existing && entry.m_Existing.Contains(key))
+			s_Hits++;
+		else
+			s_Misses++;
+
+		return IsAttributeExisting(entry, key);
+	}
+
+	//! Uncounted existence check, callers count their own hit or miss
+	//! @param key Lowercase attribute path
+	protected static bool IsAttributeExisting(ExpansionConfigCacheEntry entry, string key)
+	{
+		if (!entry.m_Exists)
+			return false;
+
+		bool exists;
+		if (entry.m_Existing)
+		{
+			if (entry.m_Existing.Find(key, exists))
+				return exists;
+		}
+		else
+		{
+			entry.m_Existing = new map<string, bool>;
+		}
+
+		exists = GetGame().ConfigIsExisting(entry.m_Path + " " + key);
+		entry.m_Existing.Insert(key, exists);
+
+		return exists;
+	}
+
+	//! @return CT_* type of the attribute, or CT_OTHER if it doesn't exist
+	static int GetType(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+		if (!entry.m_Exists)
+			return CT_OTHER;
+
+		string key = attribute;
+		key.ToLower();
+
+		int type;
+		if (entry.m_Types && entry.m_Types.Find(key, type))
+		{
+			s_Hits++;
+			return type;
+		}
+
+		s_Misses++;
+		type = GetGame().ConfigGetType(entry.m_Path + " " + key);
+
+		if (!entry.m_Types)
+			entry.m_Types = new map<string, int>;
+
+		entry.m_Types.Insert(key, type);
+
+		return type;
+	}
+
+	//! @return Text value of the attribute or empty string if it doesn't exist
+	static string GetText(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+
+		string key = attribute;
+		key.ToLower();
+
+		string value;
+		if (entry.m_Texts && entry.m_Texts.Find(key, value))
+		{
+			s_Hits++;
+			return value;
+		}
+
+		s_Misses++;
+		if (IsAttributeExisting(entry, key))
+			GetGame().ConfigGetText(entry.m_Path + " " + key, value);
+
+		if (!entry.m_Texts)
+			entry.m_Texts = new map<string, string>;
+
+		entry.m_Texts.Insert(key, value);
+
+		return value;
+	}
+
+	static float GetFloat(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+
+		string key = attribute;
+		key.ToLower();
+
+		float value;
+		if (entry.m_Floats && entry.m_Floats.Find(key, value))
+		{
+			s_Hits++;
+			return value;
+		}
+
+		s_Misses++;
+		if (IsAttributeExisting(entry, key))
+			value = GetGame().ConfigGetFloat(entry.m_Path + " " + key);
+
+		if (!entry.m_Floats)
+			entry.m_Floats = new map<string, float>;
+
+		entry.m_Floats.Insert(key, value);
+
+		return value;
+	}
+
+	static int GetInt(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+
+		string key = attribute;
+		key.ToLower();
+
+		int value;
+		if (entry.m_Ints && entry.m_Ints.Find(key, value))
+		{
+			s_Hits++;
+			return value;
+		}
+
+		s_Misses++;
+		if (IsAttributeExisting(entry, key))
+			value = GetGame().ConfigGetInt(entry.m_Path + " " + key);
+
+		if (!entry.m_Ints)
+			entry.m_Ints = new map<string, int>;
+
+		entry.m_Ints.Insert(key, value);
+
+		return value;
+	}
+
+	//! @return Shared array, empty if the attribute doesn't exist
+	static TStringArray GetTextArray(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+
+		string key = attribute;
+		key.ToLower();
+
+		TStringArray values;
+		if (entry.m_TextArrays)
+		{
+			values = entry.m_TextArrays[key];
+			if (values)
+			{
+				s_Hits++;
+				return values;
+			}
+		}
+		else
+		{
+			entry.m_TextArrays = new map<string, ref TStringArray>;
+		}
+
+		s_Misses++;
+		values = new TStringArray;
+		if (IsAttributeExisting(entry, key))
+			GetGame().ConfigGetTextArray(entry.m_Path + " " + key, values);
+		entry.m_TextArrays.Insert(key, values);
+
+		return values;
+	}
+
+	//! @return Shared array, empty if the attribute doesn't exist
+	static TIntArray GetIntArray(string root, string className, string attribute)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+
+		string key = attribute;
+		key.ToLower();
+
+		TIntArray values;
+		if (entry.m_IntArrays)
+		{
+			values = entry.m_IntArrays[key];
+			if (values)
+			{
+				s_Hits++;
+				return values;
+			}
+		}
+		else
+		{
+			entry.m_IntArrays = new map<string, ref TIntArray>;
+		}
+
+		s_Misses++;
+		values = new TIntArray;
+		if (IsAttributeExisting(entry, key))
+			GetGame().ConfigGetIntArray(entry.m_Path + " " + key, values);
+		entry.m_IntArrays.Insert(key, values);
+
+		return values;
+	}
+
+	/**
+	 * @brief Get lowercase names of the class and all its base classes, ordered from the class itself up to the root
+	 * @return Shared array, empty if the class doesn't exist
+	 */
+	static TStringArray GetHierarchy(string root, string className)
+	{
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+		if (entry.m_Hierarchy)
+		{
+			s_Hits++;
+			return entry.m_Hierarchy;
+		}
+
+		s_Misses++;
+		entry.m_Hierarchy = new TStringArray;
+		if (!entry.m_Exists)
+			return entry.m_Hierarchy;
+
+		string name = className;
+		string baseName;
+		for (int i = 0; i < MAX_HIERARCHY_DEPTH; i++)
+		{
+			name.ToLower();
+			entry.m_Hierarchy.Insert(name);
+
+			if (!GetGame().ConfigGetBaseName(root + " " + name, baseName) || baseName == string.Empty || baseName == name)
+				break;
+
+			name = baseName;
+		}
+
+		return entry.m_Hierarchy;
+	}
+
+	//! Cached GetGame().IsKindOf
+	static bool IsKindOf(string className, string baseName)
+	{
+		string root = GetRoot(className);
+		if (!root)
+			return false;
+
+		ExpansionConfigCacheEntry entry = GetEntry(root, className);
+
+		string key = baseName;
+		key.ToLower();
+
+		bool isKindOf;
+		if (entry.m_KindOf && entry.m_KindOf.Find(key, isKindOf))
+		{
+			s_Hits++;
+			return isKindOf;
+		}
+
+		s_Misses++;
+		isKindOf = GetGame().IsKindOf(className, baseName);
+
+		if (!entry.m_KindOf)
+			entry.m_KindOf = new map<string, bool>;
+
+		entry.m_KindOf.Insert(key, isKindOf);
+
+		return isKindOf;
+	}
+
+	/**
+	 * @brief Resolve root, existence and inheritance of the given classes ahead of time, e.g. on mission start,
+	 * so the first lookup during gameplay doesn't hit the engine config
+	 */
+	static void Prewarm(TStringArray classNames)
+	{
+		auto trace = EXTrace.Start(EXTrace.MISC, ExpansionConfigCache, "" + classNames.Count());
+
+		foreach (string className: classNames)
+		{
+			string root = GetRoot(className);
+			if (root)
+				GetHierarchy(root, className);
+		}
+	}
+
+	static int Count()
+	{
+		return s_Entries.Count();
+	}
+
+	static void ResetStats()
+	{
+		s_Hits = 0;
+		s_Misses = 0;
+	}
+
+	static void Clear()
+	{
+		s_Entries.Clear();
+		s_Roots.Clear();
+		ResetStats();
+	}
+
+	static void PrintStats()
+	{
+		int total = s_Hits + s_Misses;
+		float hitRate;
+		if (total > 0)
+			hitRate = s_Hits * 100.0 / total;
+
+		EXPrint("[ExpansionConfigCache] Classes: " + s_Entries.Count() + " | Hits: " + s_Hits + " | Misses: " + s_Misses + " | Hit rate: " + hitRate + "%");
+	}
+}
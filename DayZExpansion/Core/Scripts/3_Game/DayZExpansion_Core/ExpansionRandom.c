@@ -0,0 +1,84 @@
+/**
+ * ExpansionRandom.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionRandom
+ * @brief		Seedable pseudo random number generator (xorshift32)
+ *
+ * Unlike Math.Randomize, seeding an instance doesn't affect the global engine RNG,
+ * so a system can produce reproducible results (e.g. for testing loot tables) without touching anything else.
+ **/
+class ExpansionRandom
+{
+	static const int DEFAULT_SEED = 0x2545F491;
+
+	protected int m_State;
+
+	void ExpansionRandom(int seed = 0)
+	{
+		SetSeed(seed);
+	}
+
+	void SetSeed(int seed)
+	{
+		//! Xorshift state must never be zero
+		if (seed == 0)
+			seed = DEFAULT_SEED;
+
+		m_State = seed;
+	}
+
+	//! @return Random 31 bit integer
+	int Next()
+	{
+		int x = m_State;
+		x ^= x << 13;
+		x ^= (x >> 17) & 0x7FFF;  //! Logical shift, >> is arithmetic on signed ints
+		x ^= x << 5;
+		m_State = x;
+
+		return x & 0x7FFFFFFF;
+	}
+
+	//! @return Random float in range [0, 1)
+	float RandomFloat01()
+	{
+		//! Only use 24 bits so the result fits the float mantissa and can never round up to 1.0
+		return (Next() >> 7) / 16777216.0;
+	}
+
+	//! @return Random float in range [min, max)
+	float RandomFloat(float min, float max)
+	{
+		return min + RandomFloat01() * (max - min);
+	}
+
+	//! @return Random float in range [min, max]
+	float RandomFloatInclusive(float min, float max)
+	{
+		return min + ((Next() >> 7) / 16777215.0) * (max - min);
+	}
+
+	//! @return Random int in range [min, max), same as Math.RandomInt
+	int RandomInt(int min, int max)
+	{
+		if (max <= min)
+			return min;
+
+		return min + Next() % (max - min);
+	}
+
+	//! @return Random int in range [min, max], same as Math.RandomIntInclusive
+	int RandomIntInclusive(int min, int max)
+	{
+		return RandomInt(min, max + 1);
+	}
+}
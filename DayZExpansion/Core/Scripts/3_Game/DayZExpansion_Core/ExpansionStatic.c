@@ -1058,10 +1058,12 @@ class ExpansionStatic
 	// Expansion GetWeightedRandom
 	// ------------------------------------------------------------
 	//! Returns an index into the 'weights' array, or -1 if all weights are zero
-	static int GetWeightedRandom( array< float > weights )
+	//! @note Sums and scans all weights on every call, use ExpansionWeightTree when picking repeatedly from the same weights
+	static int GetWeightedRandom( array< float > weights, ExpansionRandom random = null )
 	{
+		int count = weights.Count();
 		float weightSum = 0;
-		for ( int i = 0; i < weights.Count(); i++ )
+		for ( int i = 0; i < count; i++ )
 		{
 			weightSum += weights[i];
 		}
@@ -1069,9 +1071,13 @@ class ExpansionStatic
 		if ( weightSum == 0 )
 			return -1;
 
-		float rnd = Math.RandomFloat( 0, weightSum );
+		float rnd;
+		if ( random )
+			rnd = random.RandomFloat( 0, weightSum );
+		else
+			rnd = Math.RandomFloat( 0, weightSum );
+
 		int index = 0;
-		int count = weights.Count();
 		while ( index < count )
 		{
 			if ( rnd < weights[ index ] )
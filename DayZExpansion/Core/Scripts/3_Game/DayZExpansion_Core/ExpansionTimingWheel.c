@@ -0,0 +1,143 @@
+/**
+ * ExpansionTimingWheel.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+class ExpansionTimingWheelEntry
+{
+	int m_Event;
+	Class m_Target;
+	int m_Rounds;  //! Full turns of the wheel left before the entry is due
+
+	void ExpansionTimingWheelEntry(int evt, Class target, int rounds)
+	{
+		m_Event = evt;
+		m_Target = target;
+		m_Rounds = rounds;
+	}
+}
+
+/**@class		ExpansionTimingWheel
+ * @brief		Hashed timing wheel for many delayed events driven by a single repeating timer
+ *
+ * Scheduling and cancelling are O(1) (cancel is O(entries in one slot)), and each Advance only looks at one slot,
+ * so the cost between events doesn't depend on how many events are pending.
+ * The owner calls Advance once per resolution interval and handles the returned entries.
+ **/
+class ExpansionTimingWheel
+{
+	protected ref array<ref array<ref ExpansionTimingWheelEntry>> m_Slots;
+	protected int m_Resolution;
+	protected int m_Current;
+	protected int m_Count;
+
+	//! @param resolution Interval between Advance calls in ms
+	void ExpansionTimingWheel(int resolution = 1000, int slotCount = 64)
+	{
+		m_Resolution = resolution;
+		m_Slots = new array<ref array<ref ExpansionTimingWheelEntry>>;
+
+		for (int i = 0; i < slotCount; i++)
+		{
+			m_Slots.Insert(new array<ref ExpansionTimingWheelEntry>);
+		}
+	}
+
+	/**
+	 * @brief Schedule an event
+	 * @param delay Delay in ms, rounded up to the wheel resolution (at least one Advance)
+	 * @param target Optional object the event is about, held as weak reference
+	 */
+	void Schedule(int delay, int evt, Class target = null)
+	{
+		int ticks = Math.Ceil(delay / (m_Resolution * 1.0));
+		if (ticks < 1)
+			ticks = 1;
+
+		int slotCount = m_Slots.Count();
+		int slot = (m_Current + ticks) % slotCount;
+		int rounds = (ticks - 1) / slotCount;
+
+		m_Slots[slot].Insert(new ExpansionTimingWheelEntry(evt, target, rounds));
+		m_Count++;
+	}
+
+	//! Remove all pending entries for the given event and target
+	void Cancel(int evt, Class target = null)
+	{
+		foreach (array<ref ExpansionTimingWheelEntry> entries: m_Slots)
+		{
+			for (int i = entries.Count() - 1; i >= 0; i--)
+			{
+				ExpansionTimingWheelEntry entry = entries[i];
+				if (entry.m_Event == evt && entry.m_Target == target)
+				{
+					entries.Remove(i);
+					m_Count--;
+				}
+			}
+		}
+	}
+
+	bool IsScheduled(int evt, Class target = null)
+	{
+		foreach (array<ref ExpansionTimingWheelEntry> entries: m_Slots)
+		{
+			foreach (ExpansionTimingWheelEntry entry: entries)
+			{
+				if (entry.m_Event == evt && entry.m_Target == target)
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	//! Move the wheel one slot ahead and collect entries that are due
+	void Advance(notnull array<ref ExpansionTimingWheelEntry> due)
+	{
+		m_Current = (m_Current + 1) % m_Slots.Count();
+
+		array<ref ExpansionTimingWheelEntry> entries = m_Slots[m_Current];
+		for (int i = entries.Count() - 1; i >= 0; i--)
+		{
+			ExpansionTimingWheelEntry entry = entries[i];
+			if (entry.m_Rounds > 0)
+			{
+				entry.m_Rounds--;
+				continue;
+			}
+
+			due.Insert(entry);
+			entries.Remove(i);
+			m_Count--;
+		}
+	}
+
+	void Clear()
+	{
+		foreach (array<ref ExpansionTimingWheelEntry> entries: m_Slots)
+		{
+			entries.Clear();
+		}
+
+		m_Count = 0;
+	}
+
+	int Count()
+	{
+		return m_Count;
+	}
+
+	int GetResolution()
+	{
+		return m_Resolution;
+	}
+}
@@ -0,0 +1,65 @@
+/**
+ * ExpansionTokenBucket.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionTokenBucket
+ * @brief		Rate limiter that allows bursts of up to capacity actions and refills at a fixed rate
+ **/
+class ExpansionTokenBucket
+{
+	protected float m_Capacity;
+	protected float m_RefillPerSecond;
+	protected float m_Tokens;
+	protected int m_LastTime;
+
+	void ExpansionTokenBucket(float capacity, float refillPerSecond)
+	{
+		m_Capacity = capacity;
+		m_RefillPerSecond = refillPerSecond;
+		m_Tokens = capacity;
+		m_LastTime = GetGame().GetTime();
+	}
+
+	void SetRate(float capacity, float refillPerSecond)
+	{
+		m_Capacity = capacity;
+		m_RefillPerSecond = refillPerSecond;
+
+		if (m_Tokens > capacity)
+			m_Tokens = capacity;
+	}
+
+	protected void Refill()
+	{
+		int time = GetGame().GetTime();
+		m_Tokens = Math.Min(m_Capacity, m_Tokens + (time - m_LastTime) * m_RefillPerSecond / 1000.0);
+		m_LastTime = time;
+	}
+
+	//! @return true if a token was available (and consumed)
+	bool TryConsume(float tokens = 1.0)
+	{
+		Refill();
+
+		if (m_Tokens < tokens)
+			return false;
+
+		m_Tokens -= tokens;
+		return true;
+	}
+
+	float GetTokens()
+	{
+		Refill();
+
+		return m_Tokens;
+	}
+}
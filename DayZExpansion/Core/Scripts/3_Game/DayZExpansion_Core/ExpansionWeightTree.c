@@ -0,0 +1,188 @@
+/**
+ * ExpansionWeightTree.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionWeightTree
+ * @brief		Weighted random selection over a fixed set of weights (Fenwick tree)
+ *
+ * Building is O(n), picking an index and changing a single weight are O(log n),
+ * as opposed to ExpansionStatic::GetWeightedRandom which sums and scans all weights on every pick.
+ * Build once and use CopyFrom to get a fresh working copy if weights are changed while picking (e.g. exhausted loot).
+ **/
+class ExpansionWeightTree
+{
+	protected ref array<float> m_Weights;
+	protected ref array<float> m_Tree;  //! 1-based
+	protected float m_Total;
+	protected int m_NonZero;
+	protected int m_TopBit;
+
+	void ExpansionWeightTree(array<float> weights = null)
+	{
+		m_Weights = new array<float>;
+		m_Tree = new array<float>;
+
+		if (weights)
+			Build(weights);
+	}
+
+	void Build(array<float> weights)
+	{
+		int count = weights.Count();
+
+		m_Weights.Clear();
+		m_Tree.Clear();
+		m_Tree.Insert(0);
+		m_Total = 0;
+		m_NonZero = 0;
+
+		int i;
+		float weight;
+		for (i = 0; i < count; i++)
+		{
+			weight = weights[i];
+			if (weight < 0)
+				weight = 0;
+
+			m_Weights.Insert(weight);
+			m_Tree.Insert(weight);
+			m_Total += weight;
+
+			if (weight > 0)
+				m_NonZero++;
+		}
+
+		for (i = 1; i <= count; i++)
+		{
+			int parent = i + (i & -i);
+			if (parent <= count)
+				m_Tree[parent] = m_Tree[parent] + m_Tree[i];
+		}
+
+		m_TopBit = 1;
+		while (m_TopBit * 2 <= count)
+		{
+			m_TopBit *= 2;
+		}
+	}
+
+	void CopyFrom(ExpansionWeightTree other)
+	{
+		m_Weights.Copy(other.m_Weights);
+		m_Tree.Copy(other.m_Tree);
+		m_Total = other.m_Total;
+		m_NonZero = other.m_NonZero;
+		m_TopBit = other.m_TopBit;
+	}
+
+	int Count()
+	{
+		return m_Weights.Count();
+	}
+
+	float GetTotal()
+	{
+		return m_Total;
+	}
+
+	float GetWeight(int index)
+	{
+		return m_Weights[index];
+	}
+
+	void SetWeight(int index, float weight)
+	{
+		if (weight < 0)
+			weight = 0;
+
+		float previous = m_Weights[index];
+		if (weight == previous)
+			return;
+
+		m_Weights[index] = weight;
+
+		if (previous > 0 && weight == 0)
+			m_NonZero--;
+		else if (previous == 0 && weight > 0)
+			m_NonZero++;
+
+		//! Reset the total once everything is exhausted so float error can't accumulate into a phantom weight
+		if (m_NonZero == 0)
+			m_Total = 0;
+		else
+			m_Total += weight - previous;
+
+		float delta = weight - previous;
+		int count = m_Weights.Count();
+		for (int i = index + 1; i <= count; i += i & -i)
+		{
+			m_Tree[i] = m_Tree[i] + delta;
+		}
+	}
+
+	/**
+	 * @brief Pick a random index, the chance of each index is proportional to its weight
+	 * @param random Optional seeded generator, uses the engine RNG if NULL
+	 * @return Index into the weights, or -1 if all weights are zero
+	 */
+	int Pick(ExpansionRandom random = null)
+	{
+		if (m_NonZero == 0)
+			return -1;
+
+		float rnd;
+		if (random)
+			rnd = random.RandomFloat(0, m_Total);
+		else
+			rnd = Math.RandomFloat(0, m_Total);
+
+		return Find(rnd);
+	}
+
+	//! @return Index of the weight that contains the given position in the cumulative weight range
+	int Find(float position)
+	{
+		int count = m_Weights.Count();
+		int index;
+
+		for (int step = m_TopBit; step > 0; step /= 2)
+		{
+			int next = index + step;
+			if (next <= count && m_Tree[next] <= position)
+			{
+				index = next;
+				position -= m_Tree[next];
+			}
+		}
+
+		//! Guard against float error landing past the end or on an exhausted entry
+		if (index >= count)
+			index = count - 1;
+
+		while (index >= 0 && m_Weights[index] <= 0)
+		{
+			index--;
+		}
+
+		if (index < 0)
+		{
+			for (index = 0; index < count; index++)
+			{
+				if (m_Weights[index] > 0)
+					return index;
+			}
+
+			return -1;
+		}
+
+		return index;
+	}
+}
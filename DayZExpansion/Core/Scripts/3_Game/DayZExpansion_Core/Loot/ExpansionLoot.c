@@ -37,6 +37,12 @@ class ExpansionLoot : ExpansionLootVariant
 	[NonSerialized()]
 	int m_Remaining;
 
+	[NonSerialized()]
+	ref ExpansionWeightTree m_VariantWeights;
+
+	[NonSerialized()]
+	ref array<float> m_VariantChances;  //! Variant chances m_VariantWeights was compiled from
+
 	void ExpansionLoot( string name, TStringArray attachments = NULL, float chance = 1, int quantityPercent = -1, array< ref ExpansionLootVariant > variants = NULL, int max = -1, int min = 0 )
 	{
 		QuantityPercent = quantityPercent;
@@ -44,4 +50,62 @@ class ExpansionLoot : ExpansionLootVariant
 		Min = min;
 		Variants = variants;
 	}
+
+	/**
+	 * @brief Get compiled variant chances, built on first use.
+	 * Index Variants.Count() is the parent item itself.
+	 */
+	ExpansionWeightTree GetVariantWeights()
+	{
+		if (!Variants || Variants.Count() == 0)
+			return null;
+
+		if (m_VariantWeights && IsVariantWeightsValid())
+			return m_VariantWeights;
+
+		array<float> chances = new array<float>;
+		float chancesSum;
+
+		m_VariantChances = new array<float>;
+
+		foreach (ExpansionLootVariant variant: Variants)
+		{
+			chances.Insert(variant.Chance);
+			chancesSum += variant.Chance;
+
+			m_VariantChances.Insert(variant.Chance);
+		}
+
+		//! Determine chance for parent item
+		if (chancesSum < 1.0)
+		{
+			//! Chances are treated as actual chances here, i.e. total sum is 1.0
+			chances.Insert(1.0 - chancesSum);
+		}
+		else
+		{
+			//! Just give parent item a 1.0 chance
+			chances.Insert(1.0);
+		}
+
+		m_VariantWeights = new ExpansionWeightTree(chances);
+
+		return m_VariantWeights;
+	}
+
+	//! @return false if variants were added, removed or their chances changed since m_VariantWeights was compiled
+	protected bool IsVariantWeightsValid()
+	{
+		int count = Variants.Count();
+		if (!m_VariantChances || m_VariantChances.Count() != count)
+			return false;
+
+		for (int i = 0; i < count; i++)
+		{
+			if (Variants[i].Chance != m_VariantChances[i])
+				return false;
+		}
+
+		return true;
+	}
 };
@@ -0,0 +1,105 @@
+/**
+ * ExpansionLootTable.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionLootTable
+ * @brief		Loot config compiled for weighted sampling
+ *
+ * Built once per loot array (airdrop, mission, anomaly, treasure hunt...) and reused across spawns.
+ * The cache holds a reference to the loot array, so a cached entry can't be matched by a different array reusing its address,
+ * and a cached table is only reused while the chances of the array are unchanged. The cache is cleared whenever settings are (re)loaded.
+ * Each spawn takes a working copy of the item weights via CreateSampler, so items that reach their Max
+ * can be removed from the draw without touching the compiled table.
+ **/
+class ExpansionLootTable
+{
+	static const int MAX_CACHED = 256;
+
+	protected static ref map<array<ref ExpansionLoot>, ref ExpansionLootTable> s_Tables = new map<array<ref ExpansionLoot>, ref ExpansionLootTable>;
+
+	protected ref array<ref ExpansionLoot> m_Loot;
+	protected ref array<float> m_Chances;
+	protected ref ExpansionWeightTree m_Weights;
+	protected int m_Count;
+
+	void ExpansionLootTable(array<ref ExpansionLoot> loot)
+	{
+		Compile(loot);
+	}
+
+	//! Get the compiled table for the given loot array, compiling it if needed
+	static ExpansionLootTable Get(array<ref ExpansionLoot> loot)
+	{
+		ExpansionLootTable table = s_Tables[loot];
+		if (table && table.IsCompiledFrom(loot))
+			return table;
+
+		//! Loot arrays of despawned objects or reloaded settings leave stale entries behind, just start over
+		if (!table && s_Tables.Count() >= MAX_CACHED)
+			s_Tables.Clear();
+
+		table = new ExpansionLootTable(loot);
+		s_Tables.Set(loot, table);
+
+		return table;
+	}
+
+	static void ClearCache()
+	{
+		s_Tables.Clear();
+	}
+
+	void Compile(array<ref ExpansionLoot> loot)
+	{
+		m_Chances = new array<float>;
+
+		foreach (ExpansionLoot lootItem: loot)
+		{
+			m_Chances.Insert(lootItem.Chance);
+
+			//! Compile variants ahead of time as well
+			lootItem.GetVariantWeights();
+		}
+
+		m_Loot = loot;
+		m_Weights = new ExpansionWeightTree(m_Chances);
+		m_Count = loot.Count();
+	}
+
+	//! @return true if the table was compiled from the given loot array and its item chances didn't change since
+	bool IsCompiledFrom(array<ref ExpansionLoot> loot)
+	{
+		if (m_Loot != loot || m_Count != loot.Count())
+			return false;
+
+		for (int i = 0; i < m_Count; i++)
+		{
+			if (loot[i].Chance != m_Chances[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	//! @return Working copy of the item weights for a single spawn
+	ExpansionWeightTree CreateSampler()
+	{
+		ExpansionWeightTree sampler = new ExpansionWeightTree();
+		sampler.CopyFrom(m_Weights);
+
+		return sampler;
+	}
+
+	int Count()
+	{
+		return m_Count;
+	}
+}
@@ -50,6 +50,9 @@ class ExpansionSettingBase
 			return false;
 		}
 
+		//! Loot arrays of the previous settings are no longer used
+		ExpansionLootTable.ClearCache();
+
 		return OnLoad();
 	}
 
@@ -132,6 +135,8 @@ class ExpansionSettingBase
 			else
 				Copy( setting );
 
+			ExpansionLootTable.ClearCache();
+
 			Save();
 		}
 
@@ -459,4 +459,41 @@ class ExpansionLogSettings: ExpansionSettingBase
 			CloseFile(m_FileLog);
 		}
 	}
+
+	//! Same as PrintLog for several lines at once so the log file is only opened once.
+	//! Lines need to be formatted and timestamped (ExpansionStatic::GetISOTime) by the caller.
+	void PrintLogLines(array<string> lines)
+	{
+		if (lines.Count() == 0)
+			return;
+
+		if ( !FileExist( EXPANSION_LOG_FOLDER ) )
+		{
+			ExpansionStatic.MakeDirectoryRecursive( EXPANSION_LOG_FOLDER );
+		}
+
+		if (LogToScripts || LogToADM)
+		{
+			foreach (string line: lines)
+			{
+				if (LogToScripts)
+					Print(line);
+
+				if (LogToADM)
+					GetGame().AdminLog(line);
+			}
+		} else {
+			if (!FileExist( m_FileName ))
+				m_FileLog = OpenFile(m_FileName, FileMode.WRITE);
+			else
+				m_FileLog = OpenFile(m_FileName, FileMode.APPEND);
+
+			foreach (string fileLine: lines)
+			{
+				FPrintln(m_FileLog, fileLine);
+			}
+
+			CloseFile(m_FileLog);
+		}
+	}
 };
\ No newline at end of file
@@ -0,0 +1,201 @@
+/**
+ * ExpansionVehicleGrid.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionVehicleGrid
+ * @brief		Shared coarse grid of all vehicles for radius queries
+ *
+ * A periodic sweep over CarScript::s_Expansion_AllVehicles only moves a vehicle to another cell once it is more than
+ * MOVE_THRESHOLD away from its indexed position, queries include that margin.
+ * Vehicles that were moving at the last sweep or were created since are kept in a separate list that every query checks
+ * at their current position. A vehicle that was standing still at the last sweep and got more than MOVE_THRESHOLD away
+ * before the next one (e.g. teleported) can be missed until that sweep.
+ * Started by the first query and stopped again once there was no query for IDLE_TIMEOUT, queries return vehicles within the exact radius.
+ **/
+class ExpansionVehicleGrid
+{
+	static const float CELL_SIZE = 100.0;
+	static const int CELL_ROW = 1024;  //! Max cells per row, covers maps up to ~100 km
+	static const float MOVE_THRESHOLD = 10.0;
+	static const float MOVING_SPEED = 1.0;  //! m/s
+	static const int UPDATE_INTERVAL = 1000;
+	static const int IDLE_TIMEOUT = 60000;  //! ms without queries after which sweeping stops
+
+	protected static ref map<int, ref array<CarScript>> s_Grid = new map<int, ref array<CarScript>>;
+	protected static ref array<CarScript> s_Moving = new array<CarScript>;
+	protected static bool s_Running;
+	protected static int s_LastQueryTime;
+
+	static void Start()
+	{
+		if (s_Running)
+			return;
+
+		Sweep();
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Sweep, UPDATE_INTERVAL, true);
+		s_Running = true;
+	}
+
+	static void Stop()
+	{
+		if (!s_Running)
+			return;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Sweep);
+		s_Running = false;
+
+		s_Grid.Clear();
+		s_Moving.Clear();
+
+		auto node = CarScript.s_Expansion_AllVehicles.m_Head;
+		while (node)
+		{
+			if (node.m_Value)
+				node.m_Value.m_Expansion_GridCell = -1;
+
+			node = node.m_Next;
+		}
+	}
+
+	//! Index a newly created vehicle, it is treated as moving until the next sweep in case it gets repositioned right after creation
+	static void Add(CarScript vehicle)
+	{
+		if (!s_Running)
+			return;
+
+		vehicle.m_Expansion_GridMoving = true;
+		s_Moving.Insert(vehicle);
+
+		Move(vehicle, vehicle.GetPosition());
+	}
+
+	static void Sweep()
+	{
+		if (GetGame().GetTime() - s_LastQueryTime > IDLE_TIMEOUT)
+		{
+			Stop();
+			return;
+		}
+
+		float thresholdSq = MOVE_THRESHOLD * MOVE_THRESHOLD;
+		float movingSpeedSq = MOVING_SPEED * MOVING_SPEED;
+
+		s_Moving.Clear();
+
+		auto node = CarScript.s_Expansion_AllVehicles.m_Head;
+		while (node)
+		{
+			CarScript vehicle = node.m_Value;
+			node = node.m_Next;
+
+			if (!vehicle)
+				continue;
+
+			vector position = vehicle.GetPosition();
+
+			vehicle.m_Expansion_GridMoving = GetVelocity(vehicle).LengthSq() > movingSpeedSq;
+			if (vehicle.m_Expansion_GridMoving)
+				s_Moving.Insert(vehicle);
+
+			if (vehicle.m_Expansion_GridCell == -1 || vector.DistanceSq(position, vehicle.m_Expansion_GridPosition) > thresholdSq)
+				Move(vehicle, position);
+		}
+	}
+
+	protected static void Move(CarScript vehicle, vector position)
+	{
+		int cell = GetCell(position);
+
+		vehicle.m_Expansion_GridPosition = position;
+
+		if (cell == vehicle.m_Expansion_GridCell)
+			return;
+
+		array<CarScript> vehicles;
+		if (vehicle.m_Expansion_GridCell != -1)
+		{
+			vehicles = s_Grid[vehicle.m_Expansion_GridCell];
+			if (vehicles)
+				vehicles.RemoveItem(vehicle);
+		}
+
+		vehicles = s_Grid[cell];
+		if (!vehicles)
+		{
+			vehicles = new array<CarScript>;
+			s_Grid.Insert(cell, vehicles);
+		}
+
+		vehicles.Insert(vehicle);
+		vehicle.m_Expansion_GridCell = cell;
+	}
+
+	//! Collect all vehicles within radius of position
+	static void GetNearby(vector position, float radius, notnull array<CarScript> results)
+	{
+		s_LastQueryTime = GetGame().GetTime();
+
+		Start();
+
+		float radiusSq = radius * radius;
+		float margin = radius + MOVE_THRESHOLD;
+
+		int minX = GetCellCoord(position[0] - margin);
+		int maxX = GetCellCoord(position[0] + margin);
+		int minZ = GetCellCoord(position[2] - margin);
+		int maxZ = GetCellCoord(position[2] + margin);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				array<CarScript> vehicles = s_Grid[x * CELL_ROW + z];
+				if (!vehicles)
+					continue;
+
+				for (int i = vehicles.Count() - 1; i >= 0; i--)
+				{
+					CarScript vehicle = vehicles[i];
+
+					//! Deleted vehicles leave a NULL behind
+					if (!vehicle)
+					{
+						vehicles.Remove(i);
+						continue;
+					}
+
+					if (vehicle.m_Expansion_GridMoving)
+						continue;
+
+					if (vector.DistanceSq(vehicle.GetPosition(), position) <= radiusSq)
+						results.Insert(vehicle);
+				}
+			}
+		}
+
+		foreach (CarScript movingVehicle: s_Moving)
+		{
+			if (movingVehicle && vector.DistanceSq(movingVehicle.GetPosition(), position) <= radiusSq)
+				results.Insert(movingVehicle);
+		}
+	}
+
+	static int GetCellCoord(float coord)
+	{
+		return Math.Clamp(Math.Floor(coord / CELL_SIZE), 0, CELL_ROW - 1);
+	}
+
+	static int GetCell(vector position)
+	{
+		return GetCellCoord(position[0]) * CELL_ROW + GetCellCoord(position[2]);
+	}
+}
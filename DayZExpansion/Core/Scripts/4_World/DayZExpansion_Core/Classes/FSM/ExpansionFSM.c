@@ -6,9 +6,14 @@ class ExpansionFSM
 	static const int CONTINUE = 1;
 	static const int RESTART = 2;
 
+	private static ref map<string, int> s_EventIDs = new map<string, int>();
+
 	private autoptr array<ref ExpansionState> m_States;
 	private autoptr array<ref ExpansionTransition> m_Transitions;
 
+	//! Transitions without source state, checked if there is no current state
+	private autoptr array<ExpansionTransition> m_WildcardTransitions;
+
 	private ExpansionState m_CurrentState;
 	private ExpansionState m_ParentState;
 
@@ -30,6 +35,23 @@ class ExpansionFSM
 
 		m_States = new array<ref ExpansionState>();
 		m_Transitions = new array<ref ExpansionTransition>();
+		m_WildcardTransitions = new array<ExpansionTransition>();
+	}
+
+	//! @return interned ID of event, 0 for no event
+	static int GetEventID(string e)
+	{
+		if (e == "")
+			return 0;
+
+		int id;
+		if (!s_EventIDs.Find(e, id))
+		{
+			id = s_EventIDs.Count() + 1;
+			s_EventIDs.Insert(e, id);
+		}
+
+		return id;
 	}
 
 	#ifdef CF_DEBUG
@@ -83,8 +105,14 @@ class ExpansionFSM
 		#endif
 
 		m_States.Insert(state);
+
+		GetTransitions(state);
 	}
 
+	/**
+	 * @brief Transitions are bucketed per source state so FindSuitableTransition only looks at the ones that can apply.
+	 * Wildcard transitions (no source state) are added to every bucket, keeping declaration order.
+	 */
 	void AddTransition(ExpansionTransition transition)
 	{
 		#ifdef EAI_TRACE
@@ -92,6 +120,49 @@ class ExpansionFSM
 		#endif
 
 		m_Transitions.Insert(transition);
+
+		transition.m_EventID = GetEventID(transition.GetEvent());
+
+		ExpansionState src = transition.GetSource();
+		if (src)
+		{
+			GetTransitions(src).Insert(transition);
+		}
+		else
+		{
+			m_WildcardTransitions.Insert(transition);
+
+			foreach (ExpansionState state: m_States)
+			{
+				state.m_Transitions.Insert(transition);
+			}
+		}
+	}
+
+	protected array<ExpansionTransition> GetTransitions(ExpansionState state)
+	{
+		if (!state.m_Transitions)
+		{
+			state.m_Transitions = new array<ExpansionTransition>();
+			state.m_Transitions.Copy(m_WildcardTransitions);
+		}
+
+		return state.m_Transitions;
+	}
+
+	//! Make guards with an evaluation interval of the state's transitions run on the next update
+	protected void ResetGuardTimes(ExpansionState state)
+	{
+		array<ExpansionTransition> transitions;
+		if (state && state.m_Transitions)
+			transitions = state.m_Transitions;
+		else
+			transitions = m_WildcardTransitions;
+
+		foreach (ExpansionTransition transition: transitions)
+		{
+			transition.m_NextGuardTime = 0;
+		}
 	}
 	
 	ExpansionState GetState()
@@ -149,6 +220,8 @@ class ExpansionFSM
 	
 		m_CurrentState = dst;
 		
+		ResetGuardTimes(m_CurrentState);
+
 		if (m_CurrentState)
 		{
 			CF_Log.Debug("StartDefault - Starting state: " + m_CurrentState);
@@ -182,6 +255,8 @@ class ExpansionFSM
 
 		if (m_CurrentState && src != m_CurrentState)
 		{
+			ResetGuardTimes(m_CurrentState);
+
 			CF_Log.Debug("Start - Starting state: " + m_CurrentState);
 			m_CurrentState.OnEntry(e, src);
 			return true;
@@ -252,6 +327,8 @@ class ExpansionFSM
 
 		m_CurrentState = new_state;
 
+		ResetGuardTimes(m_CurrentState);
+
 		if (m_CurrentState == null)
 		{
 			if (src)
@@ -272,14 +349,44 @@ class ExpansionFSM
 		auto trace = CF_Trace_2(this, "FindSuitableTransition").Add(s).Add(e);
 		#endif
 
+		int eventID;
+		if (e != "" && !s_EventIDs.Find(e, eventID))
+			return null;  //! No transition handles this event
+
+		return FindSuitableTransitionByEventID(s, eventID);
+	}
+
+	/**
+	 * @param eventID interned event (see GetEventID), 0 = any
+	 */
+	ExpansionState FindSuitableTransitionByEventID(ExpansionState s, int eventID)
+	{
 		// returns tuple as a valid destination can still be null
 
-		//TODO: store a reference to the transitions inside the state for that state
+		array<ExpansionTransition> transitions;
+		if (s && s.m_Transitions)
+			transitions = s.m_Transitions;
+		else
+			transitions = m_WildcardTransitions;
 
-		foreach (auto t: m_Transitions)
+		float time;
+
+		foreach (auto t: transitions)
 		{
-			if ((t.GetSource() == s || t.GetSource() == null) && (e == "" || t.GetEvent() == e))
+			if (!eventID || t.m_EventID == eventID)
 			{
+				//! Guards with an interval are skipped until it has passed, as if they failed
+				if (t.m_GuardInterval > 0)
+				{
+					if (!time)
+						time = GetGame().GetTickTime();
+
+					if (time < t.m_NextGuardTime)
+						continue;
+
+					t.m_NextGuardTime = time + t.m_GuardInterval;
+				}
+
 				switch (t.Guard())
 				{
 				case ExpansionTransition.SUCCESS:
@@ -303,7 +410,7 @@ class ExpansionFSM
 		if (m_NoTransitionCount == 0)
 		{
 			m_NoTransitionCount++;
-			EXPrint(m_Owner.ToString() + " no suitable transition found in " + m_Transitions.Count() + " transitions!");
+			EXPrint(m_Owner.ToString() + " no suitable transition found in " + transitions.Count() + " transitions!");
 		}
 		else
 		{
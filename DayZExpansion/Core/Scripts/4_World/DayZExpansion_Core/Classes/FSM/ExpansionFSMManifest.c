@@ -0,0 +1,131 @@
+class ExpansionFSMManifestEntry
+{
+	string Name;
+	string ClassName;
+	int Hash;
+
+	//! XML files (without extension) the script was generated from, the FSM itself and all sub-FSMs
+	ref TStringArray Files;
+
+	void ExpansionFSMManifestEntry()
+	{
+		Files = new TStringArray();
+	}
+};
+
+/**@class		ExpansionFSMManifest
+ * @brief		Content hashes of the FSM XMLs generated scripts were created from
+ *
+ * Used for the generated scripts in the profile FSM folder, and for precompiled scripts shipped with the mod
+ * (manifest.json and the scripts in a "Compiled" folder next to the XMLs).
+ * A script is only reused if the hash of its XMLs still matches, so editing an XML always regenerates it.
+ **/
+class ExpansionFSMManifest
+{
+	//! Increment when code generation changes so previously generated scripts aren't reused
+	static const int CODEGEN_VERSION = 2;
+
+	int m_Version;
+	ref array<ref ExpansionFSMManifestEntry> Entries;
+
+	void ExpansionFSMManifest()
+	{
+		Entries = new array<ref ExpansionFSMManifestEntry>();
+	}
+
+	static ExpansionFSMManifest Load(string filePath)
+	{
+		ExpansionFSMManifest manifest;
+		if (!ExpansionJsonFileParser<ExpansionFSMManifest>.Load(filePath, manifest) || !manifest || manifest.m_Version != CODEGEN_VERSION)
+			return null;
+
+		return manifest;
+	}
+
+	void Save(string filePath)
+	{
+		m_Version = CODEGEN_VERSION;
+
+		JsonFileLoader<ExpansionFSMManifest>.JsonSaveFile(filePath, this);
+	}
+
+	ExpansionFSMManifestEntry Get(string name)
+	{
+		foreach (ExpansionFSMManifestEntry entry: Entries)
+		{
+			if (entry.Name == name)
+				return entry;
+		}
+
+		return null;
+	}
+
+	void Set(string name, string className, int hash, TStringArray files)
+	{
+		ExpansionFSMManifestEntry entry = Get(name);
+		if (!entry)
+		{
+			entry = new ExpansionFSMManifestEntry();
+			entry.Name = name;
+			Entries.Insert(entry);
+		}
+
+		entry.ClassName = className;
+		entry.Hash = hash;
+		entry.Files.Copy(files);
+	}
+
+	//! @return true if the entry's XMLs in path are unchanged
+	static bool IsValid(ExpansionFSMManifestEntry entry, string path)
+	{
+		if (!entry || !entry.Files.Count())
+			return false;
+
+		return entry.Hash == Hash(path, entry.Files);
+	}
+
+	/**
+	 * @brief Hash of XML contents, code generation version, reload number (part of generated class names) and defines affecting generated code
+	 * @return 0 if a file doesn't exist
+	 */
+	static int Hash(string path, TStringArray files)
+	{
+		int hash = CODEGEN_VERSION * 31 + ExpansionFSMType.s_ReloadNumber;
+
+#ifdef EAI_TRACE
+		hash = hash * 31 + 1;
+#endif
+
+		foreach (string fileName: files)
+		{
+			int fileHash = HashFile(path + "/" + fileName + ".xml");
+			if (!fileHash)
+				return 0;
+
+			hash = hash * 31 + fileHash;
+		}
+
+		return hash;
+	}
+
+	static int HashFile(string filePath)
+	{
+		FileHandle file = OpenFile(filePath, FileMode.READ);
+		if (!file)
+			return 0;
+
+		int hash = 17;
+		string line;
+		while (FGets(file, line) >= 0)
+		{
+			hash = hash * 31 + line.Hash();
+		}
+
+		CloseFile(file);
+
+		if (!hash)
+			hash = 1;
+
+		return hash;
+	}
+};
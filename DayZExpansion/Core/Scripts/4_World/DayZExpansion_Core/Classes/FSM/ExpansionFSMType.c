@@ -2,6 +2,9 @@ class ExpansionFSMType
 {
 	static int s_ReloadNumber = 0;
 	static ref map<string, bool> s_Loaded = new map<string, bool>;
+
+	//! XMLs read while generating the current script
+	protected static ref TStringArray s_GeneratedFiles = new TStringArray();
 	
 	private static autoptr map<string, ExpansionFSMType> m_SpawnableTypes = new map<string, ExpansionFSMType>();
 	private static autoptr array<autoptr ExpansionFSMType> m_Types = new array<autoptr ExpansionFSMType>();
@@ -105,6 +108,18 @@ class ExpansionFSMType
 		if (s_Loaded.Find(path + "/" + fileName, success) && !success)
 			return null;
 
+		//! Precompiled script shipped with the mod, then script generated by a previous start, if their XMLs are unchanged
+		ExpansionFSMType cached_type = LoadPrecompiled(path, fileName);
+		if (!cached_type)
+			cached_type = LoadCached(path, fileName);
+
+		if (cached_type)
+		{
+			s_Loaded[path + "/" + fileName] = true;
+			AddSpawnable(fileName, cached_type);
+			return cached_type;
+		}
+
 		if (!FileExist(EXPANSION_AI_FOLDER))
 		{
 			ExpansionStatic.MakeDirectoryRecursive(EXPANSION_AI_FOLDER);
@@ -122,10 +137,18 @@ class ExpansionFSMType
 			return null;
 		}
 
+		s_GeneratedFiles.Clear();
+
 		ExpansionFSMType new_type = LoadXML(path, fileName, file);
 		
 		CloseFile(file);
 
+		if (!new_type)
+		{
+			s_Loaded[path + "/" + fileName] = false;
+			return null;
+		}
+
 		ScriptModule module = GetGame().GetMission().MissionScript;
 		new_type.m_Module = ScriptModule.LoadScript(module, script_path, false);
 		if (new_type.m_Module == null)
@@ -142,11 +165,62 @@ class ExpansionFSMType
 		CopyFile(script_path, script_path + ".bak");
 #endif
 
+		string manifest_path = EXPANSION_AI_FSM_FOLDER + "manifest.json";
+		ExpansionFSMManifest manifest = ExpansionFSMManifest.Load(manifest_path);
+		if (!manifest)
+			manifest = new ExpansionFSMManifest();
+		manifest.Set(fileName, new_type.m_ClassName, ExpansionFSMManifest.Hash(path, s_GeneratedFiles), s_GeneratedFiles);
+		manifest.Save(manifest_path);
+
 		AddSpawnable(fileName, new_type);
 
 		return new_type;
 	}
 
+	//! Load script shipped with the mod in the "Compiled" folder next to the XMLs (generated classes are named for reload number 0)
+	protected static ExpansionFSMType LoadPrecompiled(string path, string fileName)
+	{
+		if (s_ReloadNumber != 0)
+			return null;
+
+		return LoadScript(path, fileName, path + "/Compiled/manifest.json", path + "/Compiled/" + fileName + ".c");
+	}
+
+	//! Load script generated by a previous start from the profile FSM folder
+	protected static ExpansionFSMType LoadCached(string path, string fileName)
+	{
+		return LoadScript(path, fileName, EXPANSION_AI_FSM_FOLDER + "manifest.json", EXPANSION_AI_FSM_FOLDER + fileName + ".c");
+	}
+
+	protected static ExpansionFSMType LoadScript(string path, string fileName, string manifest_path, string script_path)
+	{
+		if (!FileExist(manifest_path) || !FileExist(script_path))
+			return null;
+
+		ExpansionFSMManifest manifest = ExpansionFSMManifest.Load(manifest_path);
+		if (!manifest)
+			return null;
+
+		ExpansionFSMManifestEntry entry = manifest.Get(fileName);
+		if (!ExpansionFSMManifest.IsValid(entry, path))
+			return null;
+
+		ScriptModule module = ScriptModule.LoadScript(GetGame().GetMission().MissionScript, script_path, false);
+		if (!module)
+			return null;
+
+		CF_Log.Debug("Using " + script_path + " for " + path + "/" + fileName + ".xml");
+
+		ExpansionFSMType new_type = new ExpansionFSMType();
+		new_type.m_Name = fileName;
+		new_type.m_ClassName = entry.ClassName;
+		new_type.m_Module = module;
+
+		ExpansionFSMType.Add(new_type);
+
+		return new_type;
+	}
+
 	static ExpansionFSMType LoadXML(string path, string fileName, FileHandle file)
 	{
 		#ifdef EAI_TRACE
@@ -160,6 +234,8 @@ class ExpansionFSMType
 			return null;
 		}
 
+		s_GeneratedFiles.Insert(fileName);
+
 		CF_XML_Document document;
 		CF_XML.ReadDocument(actualFilePath, document);
 
@@ -10,6 +10,9 @@ class ExpansionState
 	//! only used if there is a sub-fsm
 	ref ExpansionFSM m_SubFSM;
 
+	//! Transitions from this state and wildcard transitions in declaration order, filled by ExpansionFSM
+	ref array<ExpansionTransition> m_Transitions;
+
 	/* STATE VARIABLES */
 	ExpansionState parent;
 
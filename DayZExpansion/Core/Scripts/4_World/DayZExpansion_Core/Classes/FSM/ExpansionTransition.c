@@ -5,6 +5,13 @@ class ExpansionTransition
 
 	protected string m_ClassName;
 
+	//! Interned GetEvent(), set by ExpansionFSM::AddTransition
+	int m_EventID;
+
+	//! Seconds between guard evaluations, 0 = every update. Declared in FSM XML as <guard interval="0.25">
+	float m_GuardInterval;
+	float m_NextGuardTime;
+
 	void ExpansionTransition(ExpansionFSM _fsm)
 	{
 	}
@@ -137,14 +137,25 @@ class ExpansionTransitionType
 
 		FPrintln(file, "	Expansion_" + fsmName + "_FSM_" + ExpansionFSMType.s_ReloadNumber + " fsm;");
 
+		auto guard = xml_root_tag.GetTag("guard");
+
+		float guard_interval;
+		if (guard.Count() > 0)
+		{
+			auto guard_interval_attr = guard[0].GetAttribute("interval");
+			if (guard_interval_attr)
+				guard_interval = guard_interval_attr.ValueAsString().ToFloat();
+		}
+
 		FPrintln(file, "	void " + class_name + "(ExpansionFSM _fsm) {");
 		FPrintln(file, "		Class.CastTo(fsm, _fsm);");
 		FPrintln(file, "		m_ClassName = \"" + class_name + "\";");
+		if (guard_interval > 0)
+			FPrintln(file, "		m_GuardInterval = " + guard_interval + ";");
 		FPrintln(file, "		Class.CastTo(src, _fsm.GetState(\"" + from_state_class + "\"));");
 		FPrintln(file, "		Class.CastTo(dst, _fsm.GetState(\"" + to_state_class + "\"));");
 		FPrintln(file, "	}");
 
-		auto guard = xml_root_tag.GetTag("guard");
 		if (guard.Count() > 0)
 		{
 			FPrintln(file, "	override int Guard() {");
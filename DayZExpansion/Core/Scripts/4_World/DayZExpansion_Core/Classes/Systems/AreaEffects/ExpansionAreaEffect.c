@@ -0,0 +1,126 @@
+/**
+ * ExpansionAreaEffect.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+enum ExpansionAreaEffectShape
+{
+	SPHERE,
+	CYLINDER
+}
+
+/**@class		ExpansionAreaEffect
+ * @brief		Server side, an effect applied to all players within an area at a (randomizable) tick interval
+ *
+ * Register with ExpansionAreaEffectManager, which resolves the affected players and calls OnTick.
+ * If the effect is attached to an entity, it follows the entity and is unregistered automatically once the entity is deleted.
+ **/
+class ExpansionAreaEffect: Managed
+{
+	ExpansionAreaEffectShape m_Shape;
+	vector m_Position;
+	float m_Radius;
+	float m_PositiveHeight;  //! Cylinder only
+	float m_NegativeHeight;  //! Cylinder only
+
+	int m_TickIntervalMin = 1000;  //! ms
+	int m_TickIntervalMax = 1000;  //! ms
+	int m_NextTick;
+
+	EntityAI m_Entity;
+	bool m_HasEntity;
+
+	int m_Index = -1;  //! ExpansionAreaEffectManager
+
+	void SetSphere(float radius)
+	{
+		m_Shape = ExpansionAreaEffectShape.SPHERE;
+		m_Radius = radius;
+	}
+
+	void SetCylinder(float radius, float positiveHeight, float negativeHeight)
+	{
+		m_Shape = ExpansionAreaEffectShape.CYLINDER;
+		m_Radius = radius;
+		m_PositiveHeight = positiveHeight;
+		m_NegativeHeight = negativeHeight;
+	}
+
+	//! Interval is randomized between min and max on every tick if max is given
+	void SetTickInterval(int tickIntervalMin, int tickIntervalMax = 0)
+	{
+		if (tickIntervalMax < tickIntervalMin)
+			tickIntervalMax = tickIntervalMin;
+
+		m_TickIntervalMin = tickIntervalMin;
+		m_TickIntervalMax = tickIntervalMax;
+	}
+
+	void SetPosition(vector position)
+	{
+		m_Position = position;
+	}
+
+	void AttachTo(EntityAI entity)
+	{
+		m_Entity = entity;
+		m_HasEntity = true;
+	}
+
+	vector GetPosition()
+	{
+		if (m_Entity)
+			return m_Entity.GetPosition();
+
+		return m_Position;
+	}
+
+	//! @return false if attached entity no longer exists
+	bool IsValid()
+	{
+		if (m_HasEntity && !m_Entity)
+			return false;
+
+		return true;
+	}
+
+	int GetNextTickInterval()
+	{
+		if (m_TickIntervalMax > m_TickIntervalMin)
+			return Math.RandomIntInclusive(m_TickIntervalMin, m_TickIntervalMax);
+
+		return m_TickIntervalMin;
+	}
+
+	bool IsInside(vector center, vector position)
+	{
+		if (m_Shape == ExpansionAreaEffectShape.SPHERE)
+			return vector.DistanceSq(center, position) <= m_Radius * m_Radius;
+
+		float y = position[1] - center[1];
+		if (y > m_PositiveHeight || y < -m_NegativeHeight)
+			return false;
+
+		float dx = position[0] - center[0];
+		float dz = position[2] - center[2];
+		return dx * dx + dz * dz <= m_Radius * m_Radius;
+	}
+
+	//! Called with all players inside the area, only if there are any
+	void OnTick(array<PlayerBase> players)
+	{
+		foreach (PlayerBase player: players)
+		{
+			OnTickPlayer(player);
+		}
+	}
+
+	void OnTickPlayer(PlayerBase player);
+}
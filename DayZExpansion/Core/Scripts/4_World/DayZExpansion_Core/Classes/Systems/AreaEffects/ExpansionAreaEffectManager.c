@@ -0,0 +1,183 @@
+/**
+ * ExpansionAreaEffectManager.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionAreaEffectManager
+ * @brief		Server side, ticks all registered area effects from one timer
+ *
+ * Players are put in a grid once per tick in which any effect is due, each due effect then only tests
+ * the players in the cells it overlaps, so no per-effect world queries are needed.
+ * The timer only runs while effects are registered.
+ **/
+class ExpansionAreaEffectManager
+{
+	static const int TICK_INTERVAL = 100;
+	static const float CELL_SIZE = 25.0;
+	static const int CELL_ROW = 1024;  //! Max cells per row, covers maps up to ~25 km
+
+	protected static ref array<ref ExpansionAreaEffect> s_Effects = new array<ref ExpansionAreaEffect>;
+	protected static ref map<int, ref array<PlayerBase>> s_PlayerGrid = new map<int, ref array<PlayerBase>>;
+	protected static ref array<PlayerBase> s_Affected = new array<PlayerBase>;
+	protected static bool s_Running;
+
+	//! @param initialDelay ms until first tick
+	static void Register(ExpansionAreaEffect effect, int initialDelay = 0)
+	{
+		if (effect.m_Index != -1)
+			return;
+
+		effect.m_NextTick = GetGame().GetTime() + initialDelay;
+		effect.m_Index = s_Effects.Insert(effect);
+
+		if (!s_Running)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(Tick, TICK_INTERVAL, true);
+			s_Running = true;
+		}
+	}
+
+	static void Unregister(ExpansionAreaEffect effect)
+	{
+		int index = effect.m_Index;
+		if (index == -1)
+			return;
+
+		effect.m_Index = -1;
+
+		int last = s_Effects.Count() - 1;
+		if (index < last)
+		{
+			s_Effects[index] = s_Effects[last];
+			s_Effects[index].m_Index = index;
+		}
+
+		s_Effects.Remove(last);
+
+		if (s_Effects.Count() == 0 && s_Running)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(Tick);
+			s_Running = false;
+
+			s_PlayerGrid.Clear();
+		}
+	}
+
+	static void Tick()
+	{
+#ifdef DIAG
+		auto trace = EXTrace.Profile(EXTrace.MISC, ExpansionAreaEffectManager);
+#endif
+
+		int time = GetGame().GetTime();
+		bool isGridBuilt;
+
+		//! Backwards so effects unregistering during iteration don't get skipped
+		for (int i = s_Effects.Count() - 1; i >= 0; i--)
+		{
+			if (i >= s_Effects.Count())
+				continue;
+
+			ExpansionAreaEffect effect = s_Effects[i];
+
+			if (!effect.IsValid())
+			{
+				Unregister(effect);
+				continue;
+			}
+
+			if (time < effect.m_NextTick)
+				continue;
+
+			effect.m_NextTick = time + effect.GetNextTickInterval();
+
+			if (!isGridBuilt)
+			{
+				BuildPlayerGrid();
+				isGridBuilt = true;
+			}
+
+			s_Affected.Clear();
+			GetPlayersInside(effect, s_Affected);
+
+			if (s_Affected.Count())
+				effect.OnTick(s_Affected);
+		}
+	}
+
+	protected static void BuildPlayerGrid()
+	{
+		s_PlayerGrid.Clear();
+
+		auto node = PlayerBase.s_Expansion_AllPlayers.m_Head;
+		while (node)
+		{
+			PlayerBase player = node.m_Value;
+			node = node.m_Next;
+
+			if (!player || !player.IsAlive())
+				continue;
+
+			int cell = GetCell(player.GetPosition());
+
+			array<PlayerBase> players = s_PlayerGrid[cell];
+			if (!players)
+			{
+				players = new array<PlayerBase>;
+				s_PlayerGrid.Insert(cell, players);
+			}
+
+			players.Insert(player);
+		}
+	}
+
+	//! Collect living players inside effect area, grid needs to be built
+	protected static void GetPlayersInside(ExpansionAreaEffect effect, notnull array<PlayerBase> results)
+	{
+		vector center = effect.GetPosition();
+		float radius = effect.m_Radius;
+
+		int minX = GetCellCoord(center[0] - radius);
+		int maxX = GetCellCoord(center[0] + radius);
+		int minZ = GetCellCoord(center[2] - radius);
+		int maxZ = GetCellCoord(center[2] + radius);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				array<PlayerBase> players = s_PlayerGrid[x * CELL_ROW + z];
+				if (!players)
+					continue;
+
+				foreach (PlayerBase player: players)
+				{
+					if (player && effect.IsInside(center, player.GetPosition()))
+						results.Insert(player);
+				}
+			}
+		}
+	}
+
+	static int GetCellCoord(float coord)
+	{
+		return Math.Clamp(Math.Floor(coord / CELL_SIZE), 0, CELL_ROW - 1);
+	}
+
+	static int GetCell(vector position)
+	{
+		return GetCellCoord(position[0]) * CELL_ROW + GetCellCoord(position[2]);
+	}
+
+	static int Count()
+	{
+		return s_Effects.Count();
+	}
+}
@@ -14,6 +14,11 @@
  * @brief		This class handle expansion monitor module
  * @note		Player identity plain (steam64) ID is used for stats and states to reduce data payload,
  * 				normal (hashed) ID is used for player death position
+ *
+ * Clients that continuously display other players (party HUD) subscribe to their plain IDs instead of polling.
+ * Every SUBSCRIPTION_UPDATE_INTERVAL the server updates stats and states of watched players only (once per player,
+ * however many subscribers), and sends each subscriber a delta with the fields that changed by more than the
+ * thresholds in ExpansionMonitorSubscription, plus a full update every KEYFRAME_TICKS as deltas are unguaranteed.
  **/
 
 #ifdef EXPANSIONMONITORMODULE
@@ -22,6 +27,8 @@ class ExpansionMonitorModule: CF_ModuleWorld
 {
 	private const float UPDATE_TICK_TIME = 1.0; // refreshes 100 players every ten seconds
 	private const int UPDATE_PLAYERS_PER_TICK = 10;
+	static const int SUBSCRIPTION_UPDATE_INTERVAL = 500;
+	static const int KEYFRAME_TICKS = 20;
 
 	//Server only
 	private ref map<string, ref ExpansionSyncedPlayerStats> m_Stats;
@@ -30,6 +37,13 @@ class ExpansionMonitorModule: CF_ModuleWorld
 	
 	private float m_UpdateQueueTimer;
 	private int m_CurrentPlayerTick;
+
+	//! Key: subscriber UID
+	private ref map<string, ref ExpansionMonitorSubscriber> m_Subscribers;
+	//! Key: watched player plain ID, value: whether the player is available this tick
+	private ref map<string, bool> m_TickPlayers;
+	private int m_SubscriptionCount;
+	private int m_SubscriptionTick;
 	
 	//Client only
 	static ref ExpansionSyncedPlayerStats m_ClientStats;
@@ -38,6 +52,11 @@ class ExpansionMonitorModule: CF_ModuleWorld
 	static ref ScriptInvoker m_StatsInvoker = new ScriptInvoker();
 	static ref ScriptInvoker m_StatesInvoker = new ScriptInvoker();
 
+	//! Key: watched player plain ID
+	private ref map<string, int> m_ClientSubscriptions;
+	private ref map<string, ref ExpansionSyncedPlayerStats> m_SubscribedStats;
+	private ref map<string, ref ExpansionSyncedPlayerStates> m_SubscribedStates;
+
 	vector m_LastDeathPos;
 	
 	// Server & Client
@@ -70,6 +89,13 @@ class ExpansionMonitorModule: CF_ModuleWorld
 
 		m_PlayerIDs = new TStringArray();
 
+		m_Subscribers = new map<string, ref ExpansionMonitorSubscriber>;
+		m_TickPlayers = new map<string, bool>;
+
+		m_ClientSubscriptions = new map<string, int>;
+		m_SubscribedStats = new map<string, ref ExpansionSyncedPlayerStats>;
+		m_SubscribedStates = new map<string, ref ExpansionSyncedPlayerStates>;
+
 		m_ClientStats = new ExpansionSyncedPlayerStats;
 		m_ClientStates = new ExpansionSyncedPlayerStates;
 		
@@ -78,6 +104,9 @@ class ExpansionMonitorModule: CF_ModuleWorld
 		Expansion_RegisterServerRPC("RPC_RequestPlayerStates");
 		Expansion_RegisterServerRPC("RPC_RequestPlayerStats");
 		Expansion_RegisterServerRPC("RPC_RequestPlayerStatsAndStates");
+		Expansion_RegisterServerRPC("RPC_Subscribe");
+		Expansion_RegisterServerRPC("RPC_Unsubscribe");
+		Expansion_RegisterClientRPC("RPC_SendPlayerDelta");
 		Expansion_RegisterClientRPC("RPC_SyncStats");
 		Expansion_RegisterClientRPC("RPC_SyncStates");
 		Expansion_RegisterClientRPC("RPC_SendMessage");
@@ -230,6 +259,8 @@ class ExpansionMonitorModule: CF_ModuleWorld
 		RemovePlayerStats(playerID);
 		RemovePlayerStates(playerID);
 		m_PlayerIDs.RemoveItem(playerID);
+
+		RemoveSubscriber(cArgs.UID);
 	}
 	
 	// ------------------------------------------------------------
@@ -927,6 +958,265 @@ class ExpansionMonitorModule: CF_ModuleWorld
 		rpc.Expansion_Send(false);
 	}
 
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule Subscribe
+	// Called from client - start receiving updates for player with plain ID, reference counted
+	// ------------------------------------------------------------
+	void Subscribe(string playerID, bool includeStates = false)
+	{
+		auto trace = EXTrace.Start(ExpansionTracing.PLAYER_MONITOR, this, playerID, "" + includeStates);
+
+		int count = m_ClientSubscriptions[playerID];
+		m_ClientSubscriptions.Set(playerID, count + 1);
+
+		if (count > 0)
+			return;
+
+		auto rpc = Expansion_CreateRPC("RPC_Subscribe");
+		rpc.Write(playerID);
+		rpc.Write(includeStates);
+		rpc.Expansion_Send(true);
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule Unsubscribe
+	// Called from client
+	// ------------------------------------------------------------
+	void Unsubscribe(string playerID)
+	{
+		auto trace = EXTrace.Start(ExpansionTracing.PLAYER_MONITOR, this, playerID);
+
+		int count;
+		if (!m_ClientSubscriptions.Find(playerID, count))
+			return;
+
+		if (count > 1)
+		{
+			m_ClientSubscriptions.Set(playerID, count - 1);
+			return;
+		}
+
+		m_ClientSubscriptions.Remove(playerID);
+		m_SubscribedStats.Remove(playerID);
+		m_SubscribedStates.Remove(playerID);
+
+		if (!GetGame() || !GetGame().GetMission())
+			return;
+
+		auto rpc = Expansion_CreateRPC("RPC_Unsubscribe");
+		rpc.Write(playerID);
+		rpc.Expansion_Send(true);
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule GetSubscribedStats
+	// Called on client - last received stats of a subscribed player, NULL if nothing was received yet
+	// ------------------------------------------------------------
+	ExpansionSyncedPlayerStats GetSubscribedStats(string playerID)
+	{
+		return m_SubscribedStats[playerID];
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule RPC_Subscribe
+	// Called on server
+	// ------------------------------------------------------------
+	private void RPC_Subscribe(PlayerIdentity sender, Object target, ParamsReadContext ctx)
+	{
+		string playerID;
+		if (!ctx.Read(playerID))
+			return;
+
+		bool includeStates;
+		if (!ctx.Read(includeStates))
+			return;
+
+		if (!sender || !playerID)
+			return;
+
+		auto trace = EXTrace.Start(ExpansionTracing.PLAYER_MONITOR, this, sender.GetId(), playerID, "" + includeStates);
+
+		ExpansionMonitorSubscriber subscriber = m_Subscribers[sender.GetId()];
+		if (!subscriber)
+		{
+			subscriber = new ExpansionMonitorSubscriber(sender);
+			m_Subscribers.Insert(sender.GetId(), subscriber);
+		}
+
+		ExpansionMonitorSubscription subscription = subscriber.m_Subscriptions[playerID];
+		if (subscription)
+		{
+			//! Resubscribed, e.g. after the client lost track, send everything again
+			subscription.m_IncludeStates = includeStates;
+			subscription.m_HasSent = false;
+			return;
+		}
+
+		if (subscriber.m_Subscriptions.Count() >= ExpansionMonitorSubscriber.MAX_SUBSCRIPTIONS)
+		{
+			EXPrint("[ExpansionMonitorModule] WARNING: " + sender.GetId() + " exceeded max subscriptions (" + ExpansionMonitorSubscriber.MAX_SUBSCRIPTIONS + ")");
+			return;
+		}
+
+		subscriber.m_Subscriptions.Insert(playerID, new ExpansionMonitorSubscription(includeStates));
+
+		if (m_SubscriptionCount == 0)
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(UpdateSubscriptions, SUBSCRIPTION_UPDATE_INTERVAL, true);
+
+		m_SubscriptionCount++;
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule RPC_Unsubscribe
+	// Called on server
+	// ------------------------------------------------------------
+	private void RPC_Unsubscribe(PlayerIdentity sender, Object target, ParamsReadContext ctx)
+	{
+		string playerID;
+		if (!ctx.Read(playerID))
+			return;
+
+		if (!sender)
+			return;
+
+		auto trace = EXTrace.Start(ExpansionTracing.PLAYER_MONITOR, this, sender.GetId(), playerID);
+
+		ExpansionMonitorSubscriber subscriber = m_Subscribers[sender.GetId()];
+		if (!subscriber || !subscriber.m_Subscriptions.Contains(playerID))
+			return;
+
+		subscriber.m_Subscriptions.Remove(playerID);
+		if (subscriber.m_Subscriptions.Count() == 0)
+			m_Subscribers.Remove(sender.GetId());
+
+		OnSubscriptionsRemoved(1);
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule RemoveSubscriber
+	// Called on server
+	// ------------------------------------------------------------
+	private void RemoveSubscriber(string uid)
+	{
+		ExpansionMonitorSubscriber subscriber;
+		if (!m_Subscribers.Find(uid, subscriber))
+			return;
+
+		m_Subscribers.Remove(uid);
+
+		OnSubscriptionsRemoved(subscriber.m_Subscriptions.Count());
+	}
+
+	private void OnSubscriptionsRemoved(int count)
+	{
+		m_SubscriptionCount -= count;
+
+		if (m_SubscriptionCount <= 0)
+		{
+			m_SubscriptionCount = 0;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(UpdateSubscriptions);
+		}
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule UpdateSubscriptions
+	// Called on server
+	// ------------------------------------------------------------
+	private void UpdateSubscriptions()
+	{
+		m_SubscriptionTick++;
+		bool keyframe = m_SubscriptionTick % KEYFRAME_TICKS == 0;
+
+		m_TickPlayers.Clear();
+
+		foreach (string uid, ExpansionMonitorSubscriber subscriber: m_Subscribers)
+		{
+			if (!subscriber.m_Identity)
+				continue;
+
+			foreach (string playerID, ExpansionMonitorSubscription subscription: subscriber.m_Subscriptions)
+			{
+				ExpansionSyncedPlayerStats stats = m_Stats[playerID];
+				if (!stats)
+					continue;
+
+				ExpansionSyncedPlayerStates states = m_States[playerID];
+
+				//! Update each watched player only once per tick
+				bool available = false;
+				if (!m_TickPlayers.Find(playerID, available))
+				{
+					PlayerBase player = PlayerBase.Expansion_GetByPlainID(playerID);
+					if (player)
+					{
+						available = true;
+
+						UpdateStats(stats, player, false, false, true);
+						if (states)
+							UpdateStates(states, player, false);
+					}
+
+					m_TickPlayers.Insert(playerID, available);
+				}
+
+				//! Player will be NULL if dead
+				if (!available)
+					continue;
+
+				int mask = subscription.GetDeltaMask(stats, states, keyframe);
+				if (!mask)
+					continue;
+
+				auto rpc = Expansion_CreateRPC("RPC_SendPlayerDelta");
+				rpc.Write(playerID);
+				subscription.Write(rpc, mask, stats, states);
+				//! @note guaranteed = false is intentional here (performance), keyframes make up for lost deltas
+				rpc.Expansion_Send(false, subscriber.m_Identity);
+			}
+		}
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMonitorModule RPC_SendPlayerDelta
+	// Called on client
+	// ------------------------------------------------------------
+	private void RPC_SendPlayerDelta(PlayerIdentity sender, Object target, ParamsReadContext ctx)
+	{
+		string playerID;
+		if (!ctx.Read(playerID))
+			return;
+
+		//! Unsubscribed while the update was underway
+		if (!m_ClientSubscriptions.Contains(playerID))
+			return;
+
+		ExpansionSyncedPlayerStats playerStats = m_SubscribedStats[playerID];
+		if (!playerStats)
+		{
+			playerStats = new ExpansionSyncedPlayerStats;
+			playerStats.m_PlainID = playerID;
+			m_SubscribedStats.Insert(playerID, playerStats);
+		}
+
+		ExpansionSyncedPlayerStates playerStates = m_SubscribedStates[playerID];
+		if (!playerStates)
+		{
+			playerStates = new ExpansionSyncedPlayerStates;
+			playerStates.m_PlainID = playerID;
+			m_SubscribedStates.Insert(playerID, playerStates);
+		}
+
+		int mask;
+		if (!ExpansionMonitorSubscription.Read(ctx, mask, playerStats, playerStates))
+			return;
+
+		if ((mask & ExpansionMonitorDelta.BASE_STATS) && playerStats.m_HasBaseStats)
+			m_StatsInvoker.Invoke(playerStats);
+
+		if (mask & ExpansionMonitorDelta.ALL_STATES)
+			m_StatesInvoker.Invoke(playerStates);
+	}
+
 	// ------------------------------------------------------------
 	// ExpansionMonitorModule AddLastPlayerDeathPos
 	// Called on server
@@ -0,0 +1,260 @@
+/**
+ * ExpansionMonitorSubscription.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+//! Fields contained in a monitor delta update
+enum ExpansionMonitorDelta
+{
+	HEALTH = 1,
+	BLOOD = 2,
+	WATER = 4,
+	ENERGY = 8,
+	POSITION = 16,
+	STATES = 32,
+	STANCE = 64,
+
+	BASE_STATS = 31,
+	ALL_STATES = 96
+}
+
+/**@class		ExpansionMonitorSubscription
+ * @brief		Server side, one player watched by one subscriber
+ *
+ * Keeps the values last sent to the subscriber. A field is only sent again once it differs from the last sent value
+ * by more than its threshold, values below the threshold are not acknowledged so slow drift is still sent eventually.
+ **/
+class ExpansionMonitorSubscription
+{
+	static const int STAT_THRESHOLD = 1;  //! percent
+	static const float POSITION_THRESHOLD = 1.0;  //! meters
+
+	bool m_IncludeStates;
+	bool m_HasSent;
+
+	ref ExpansionSyncedPlayerStats m_LastStats;
+	ref ExpansionSyncedPlayerStates m_LastStates;
+
+	void ExpansionMonitorSubscription(bool includeStates)
+	{
+		m_IncludeStates = includeStates;
+		m_LastStats = new ExpansionSyncedPlayerStats;
+		m_LastStates = new ExpansionSyncedPlayerStates;
+	}
+
+	//! @param full send all fields regardless of thresholds (initial update and periodic keyframes, as deltas are sent unguaranteed)
+	int GetDeltaMask(ExpansionSyncedPlayerStats stats, ExpansionSyncedPlayerStates states, bool full = false)
+	{
+		int mask;
+
+		if (full || !m_HasSent)
+		{
+			mask = ExpansionMonitorDelta.BASE_STATS;
+			if (m_IncludeStates && states)
+				mask |= ExpansionMonitorDelta.ALL_STATES;
+
+			return mask;
+		}
+
+		if (Math.AbsInt(stats.m_Health - m_LastStats.m_Health) >= STAT_THRESHOLD)
+			mask |= ExpansionMonitorDelta.HEALTH;
+
+		if (Math.AbsInt(stats.m_Blood - m_LastStats.m_Blood) >= STAT_THRESHOLD)
+			mask |= ExpansionMonitorDelta.BLOOD;
+
+		if (Math.AbsInt(stats.m_Water - m_LastStats.m_Water) >= STAT_THRESHOLD)
+			mask |= ExpansionMonitorDelta.WATER;
+
+		if (Math.AbsInt(stats.m_Energy - m_LastStats.m_Energy) >= STAT_THRESHOLD)
+			mask |= ExpansionMonitorDelta.ENERGY;
+
+		if (vector.DistanceSq(stats.m_Position, m_LastStats.m_Position) >= POSITION_THRESHOLD * POSITION_THRESHOLD)
+			mask |= ExpansionMonitorDelta.POSITION;
+
+		if (m_IncludeStates && states)
+		{
+			if (HasStatesChanged(states))
+				mask |= ExpansionMonitorDelta.STATES;
+
+			if (states.m_Stance != m_LastStates.m_Stance)
+				mask |= ExpansionMonitorDelta.STANCE;
+		}
+
+		return mask;
+	}
+
+	protected bool HasStatesChanged(ExpansionSyncedPlayerStates states)
+	{
+		if (states.m_Bones != m_LastStates.m_Bones)
+			return true;
+
+		if (states.m_Sick != m_LastStates.m_Sick)
+			return true;
+
+		if (states.m_Cholera != m_LastStates.m_Cholera)
+			return true;
+
+		if (states.m_Influenza != m_LastStates.m_Influenza)
+			return true;
+
+		if (states.m_Salmonella != m_LastStates.m_Salmonella)
+			return true;
+
+		if (states.m_Poison != m_LastStates.m_Poison)
+			return true;
+
+		if (states.m_Infection != m_LastStates.m_Infection)
+			return true;
+
+		if (states.m_Cuts != m_LastStates.m_Cuts)
+			return true;
+
+		return false;
+	}
+
+	//! Write fields in mask and remember them as last sent
+	void Write(ParamsWriteContext ctx, int mask, ExpansionSyncedPlayerStats stats, ExpansionSyncedPlayerStates states)
+	{
+		ctx.Write(mask);
+
+		if (mask & ExpansionMonitorDelta.HEALTH)
+		{
+			ctx.Write(stats.m_Health);
+			m_LastStats.m_Health = stats.m_Health;
+		}
+
+		if (mask & ExpansionMonitorDelta.BLOOD)
+		{
+			ctx.Write(stats.m_Blood);
+			m_LastStats.m_Blood = stats.m_Blood;
+		}
+
+		if (mask & ExpansionMonitorDelta.WATER)
+		{
+			ctx.Write(stats.m_Water);
+			m_LastStats.m_Water = stats.m_Water;
+		}
+
+		if (mask & ExpansionMonitorDelta.ENERGY)
+		{
+			ctx.Write(stats.m_Energy);
+			m_LastStats.m_Energy = stats.m_Energy;
+		}
+
+		if (mask & ExpansionMonitorDelta.POSITION)
+		{
+			ctx.Write(stats.m_Position);
+			m_LastStats.m_Position = stats.m_Position;
+		}
+
+		if (mask & ExpansionMonitorDelta.STATES)
+		{
+			ctx.Write(states.m_Bones);
+			ctx.Write(states.m_Sick);
+			ctx.Write(states.m_Cholera);
+			ctx.Write(states.m_Influenza);
+			ctx.Write(states.m_Salmonella);
+			ctx.Write(states.m_Poison);
+			ctx.Write(states.m_Infection);
+			ctx.Write(states.m_Cuts);
+
+			m_LastStates.m_Bones = states.m_Bones;
+			m_LastStates.m_Sick = states.m_Sick;
+			m_LastStates.m_Cholera = states.m_Cholera;
+			m_LastStates.m_Influenza = states.m_Influenza;
+			m_LastStates.m_Salmonella = states.m_Salmonella;
+			m_LastStates.m_Poison = states.m_Poison;
+			m_LastStates.m_Infection = states.m_Infection;
+			m_LastStates.m_Cuts = states.m_Cuts;
+		}
+
+		if (mask & ExpansionMonitorDelta.STANCE)
+		{
+			ctx.Write(states.m_Stance);
+			m_LastStates.m_Stance = states.m_Stance;
+		}
+
+		m_HasSent = true;
+	}
+
+	//! Client, apply a delta written by Write
+	static bool Read(ParamsReadContext ctx, out int mask, ExpansionSyncedPlayerStats stats, ExpansionSyncedPlayerStates states)
+	{
+		if (!ctx.Read(mask))
+			return false;
+
+		if ((mask & ExpansionMonitorDelta.HEALTH) && !ctx.Read(stats.m_Health))
+			return false;
+
+		if ((mask & ExpansionMonitorDelta.BLOOD) && !ctx.Read(stats.m_Blood))
+			return false;
+
+		if ((mask & ExpansionMonitorDelta.WATER) && !ctx.Read(stats.m_Water))
+			return false;
+
+		if ((mask & ExpansionMonitorDelta.ENERGY) && !ctx.Read(stats.m_Energy))
+			return false;
+
+		if ((mask & ExpansionMonitorDelta.POSITION) && !ctx.Read(stats.m_Position))
+			return false;
+
+		if ((mask & ExpansionMonitorDelta.BASE_STATS) == ExpansionMonitorDelta.BASE_STATS)
+			stats.m_HasBaseStats = true;
+
+		if (mask & ExpansionMonitorDelta.STATES)
+		{
+			if (!ctx.Read(states.m_Bones))
+				return false;
+
+			if (!ctx.Read(states.m_Sick))
+				return false;
+
+			if (!ctx.Read(states.m_Cholera))
+				return false;
+
+			if (!ctx.Read(states.m_Influenza))
+				return false;
+
+			if (!ctx.Read(states.m_Salmonella))
+				return false;
+
+			if (!ctx.Read(states.m_Poison))
+				return false;
+
+			if (!ctx.Read(states.m_Infection))
+				return false;
+
+			if (!ctx.Read(states.m_Cuts))
+				return false;
+		}
+
+		if ((mask & ExpansionMonitorDelta.STANCE) && !ctx.Read(states.m_Stance))
+			return false;
+
+		return true;
+	}
+}
+
+/**@class		ExpansionMonitorSubscriber
+ * @brief		Server side, players watched by one client
+ **/
+class ExpansionMonitorSubscriber
+{
+	static const int MAX_SUBSCRIPTIONS = 32;
+
+	PlayerIdentity m_Identity;
+	ref map<string, ref ExpansionMonitorSubscription> m_Subscriptions;
+
+	void ExpansionMonitorSubscriber(PlayerIdentity identity)
+	{
+		m_Identity = identity;
+		m_Subscriptions = new map<string, ref ExpansionMonitorSubscription>;
+	}
+}
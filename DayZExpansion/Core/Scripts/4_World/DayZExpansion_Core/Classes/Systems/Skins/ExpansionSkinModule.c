@@ -195,16 +195,16 @@ class ExpansionSkinModule: CF_ModuleWorld
 	string GetConfigPath( string classname )
 	{
 		string path = "cfgVehicles";
-		if ( !GetGame().ConfigIsExisting( path + " " + classname ) )
+		if ( !ExpansionConfigCache.IsExisting( path, classname ) )
 		{
 			path = "cfgWeapons";
-			if ( !GetGame().ConfigIsExisting( path + " " + classname ) )
+			if ( !ExpansionConfigCache.IsExisting( path, classname ) )
 			{
 				path = "cfgMagazines";
-				if ( !GetGame().ConfigIsExisting( path + " " + classname ) )
+				if ( !ExpansionConfigCache.IsExisting( path, classname ) )
 				{
 					path = "cfgNonAIVehicles";
-					if ( !GetGame().ConfigIsExisting( path + " " + classname ) )
+					if ( !ExpansionConfigCache.IsExisting( path, classname ) )
 					{
 						if(classname)
 							Print( "ExpansionSkinModule::GetConfigPath - [ERROR]: Invalid class name " + classname );
@@ -264,8 +264,8 @@ class ExpansionSkinModule: CF_ModuleWorld
 	string GetSkinName( string classname )
 	{
 		string path = GetConfigPath( classname );
-		if ( path && GetGame().ConfigIsExisting( path + " " + classname + " skinName" ) )
-			return GetGame().ConfigGetTextOut( path + " " + classname + " skinName" );
+		if ( path )
+			return ExpansionConfigCache.GetText( path, classname, "skinName" );
 		return "";
 	}
 	
@@ -289,8 +289,8 @@ class ExpansionSkinModule: CF_ModuleWorld
 
 			//! If it exists, use skinBase instead of given classname
 			//! (so when spawning <thing>_<skinname>, it has the correct skin)
-			if ( GetGame().ConfigIsExisting( path + " " + classname + " skinBase" ) )
-				GetGame().ConfigGetText( path + " " + classname + " skinBase", skinBase );
+			if ( path )
+				skinBase = ExpansionConfigCache.GetText( path, classname, "skinBase" );
 
 			if ( !skinBase )
 				skinBase = classname;
@@ -314,8 +314,8 @@ class ExpansionSkinModule: CF_ModuleWorld
 
 			//! If it exists, use skinName instead of default skin
 			//! (so when spawning <thing>_<skinname>, it has the correct skin)
-			if ( GetGame().ConfigIsExisting( path + " " + classname + " skinName" ) )
-				GetGame().ConfigGetText( path + " " + classname + " skinName", skinName );
+			if ( path )
+				skinName = ExpansionConfigCache.GetText( path, classname, "skinName" );
 
 			if ( !skinName )
 				skinName = skins.GetDefaultSkin();
@@ -19,6 +19,11 @@ modded class CarScript
 
 	ref CF_DoublyLinkedNode_WeakRef<CarScript> m_Expansion_Node;
 
+	//! ExpansionVehicleGrid
+	int m_Expansion_GridCell = -1;
+	vector m_Expansion_GridPosition;
+	bool m_Expansion_GridMoving;
+
 	protected autoptr ExpansionZoneActor m_Expansion_SafeZoneInstance = new ExpansionZoneEntity<CarScript>(this);
 
 	protected bool m_Expansion_IsInSafeZone;
@@ -327,6 +332,9 @@ modded class CarScript
 
 		if (IsMissionHost() && GetExpansionSettings().GetSafeZone().Enabled)
 			m_Expansion_SafeZoneInstance.Update();
+
+		if (IsMissionHost())
+			ExpansionVehicleGrid.Add(this);
 	}
 
 	override void DamageCrew(float dmg)
@@ -47,7 +47,7 @@ class ExpansionItemSpawnHelper
 			}
 
 			//! Spawn on ground
-			obj = GetGame().CreateObject(className, parent.GetPosition(), false, GetGame().IsKindOf(className, "DZ_LightAI"));
+			obj = GetGame().CreateObject(className, parent.GetPosition(), false, ExpansionConfigCache.IsKindOf(className, "DZ_LightAI"));
 			if (!Class.CastTo(item, obj))
 			{
 				if (obj)
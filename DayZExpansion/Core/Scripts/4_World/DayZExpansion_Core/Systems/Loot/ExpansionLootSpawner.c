@@ -12,43 +12,47 @@
 
 class ExpansionLootSpawner
 {
-	static void AddItem(EntityAI container, ExpansionLoot loot, array<EntityAI> spawnedEntities = null, map<string, int> spawnedEntitiesMap = null, bool spawnOnGround = false, float damagePercentMin = 0, float damagePercentMax = 0)
+	//! Set via SetSeed to make loot rolls reproducible, NULL uses the engine RNG
+	protected static ref ExpansionRandom s_Random;
+
+	/**
+	 * @brief Use a seeded generator for all following loot rolls (item/variant picks, item count, quantity and damage)
+	 * so the same loot config and seed always produce the same loot.
+	 * Set on server start with the command line parameter -expansionLootSeed=<seed>, see MissionServer::OnMissionLoaded
+	 */
+	static void SetSeed(int seed)
 	{
-		string className = loot.Name;
-		
-		TStringArray attachments = loot.Attachments;
+		s_Random = new ExpansionRandom(seed);
+	}
 
-		if ( loot.Variants && loot.Variants.Count() > 0 )
-		{
-			array< float > chances = new array< float >;
+	static int RandomInt(int min, int max)
+	{
+		if (s_Random)
+			return s_Random.RandomInt(min, max);
 
-			int count = loot.Variants.Count();
-			float chance;
-			float chancesSum;
+		return Math.RandomInt(min, max);
+	}
 
-			foreach (ExpansionLootVariant variant: loot.Variants)
-			{
-				chance = variant.Chance;
-				chances.Insert( chance );
-				chancesSum += chance;
-			}
+	static float RandomFloatInclusive(float min, float max)
+	{
+		if (s_Random)
+			return s_Random.RandomFloatInclusive(min, max);
 
-			//! Determine chance for parent item
-			if ( chancesSum < 1.0 )
-			{
-				//! Chances are treated as actual chances here, i.e. total sum is 1.0
-				chance = 1.0 - chancesSum;
-			} else
-			{
-				//! Just give parent item a 1.0 chance
-				chance = 1.0;
-			}
+		return Math.RandomFloatInclusive(min, max);
+	}
 
-			chances.Insert( chance );
+	static void AddItem(EntityAI container, ExpansionLoot loot, array<EntityAI> spawnedEntities = null, map<string, int> spawnedEntitiesMap = null, bool spawnOnGround = false, float damagePercentMin = 0, float damagePercentMax = 0)
+	{
+		string className = loot.Name;
+		
+		TStringArray attachments = loot.Attachments;
 
-			int index = ExpansionStatic.GetWeightedRandom( chances );
+		ExpansionWeightTree variantWeights = loot.GetVariantWeights();
+		if ( variantWeights )
+		{
+			int index = variantWeights.Pick( s_Random );
 
-			if ( index > -1 && index < count )
+			if ( index > -1 && index < loot.Variants.Count() )
 			{
 				className = loot.Variants[index].Name;
 				if ( loot.Variants[index].Attachments && loot.Variants[index].Attachments.Count() > 0 )
@@ -108,7 +112,7 @@ class ExpansionLootSpawner
 					float quantityMax01 = profile.GetQuantityMax();
 
 					if (quantityMin01 >= 0 && quantityMax01 > 0)
-						quantity01 = Math.RandomFloatInclusive( quantityMin01, quantityMax01 );
+						quantity01 = RandomFloatInclusive( quantityMin01, quantityMax01 );
 					else
 						quantityPercent = -1;
 				}
@@ -156,7 +160,7 @@ class ExpansionLootSpawner
 			if (damagePercentMin > 0 || damagePercentMax > 0)
 			{
 				float maxHealth = item.GetMaxHealth("", "");
-				float healthModifier = Math.RandomFloatInclusive(damagePercentMin, damagePercentMax);
+				float healthModifier = RandomFloatInclusive(damagePercentMin, damagePercentMax);
 				item.SetHealth("", "", maxHealth * healthModifier);
 			}
 
@@ -182,16 +186,22 @@ class ExpansionLootSpawner
 	}
 
 	static void SpawnLoot(EntityAI container, array < ref ExpansionLoot > loot, int itemCount, array<EntityAI> spawnedEntities = null, map<string, int> spawnedEntitiesMap = null, bool spawnOnGround = false, float damagePercentMin = 0, float damagePercentMax = 0 )
+	{
+		SpawnLoot(container, loot, ExpansionLootTable.Get(loot), itemCount, spawnedEntities, spawnedEntitiesMap, spawnOnGround, damagePercentMin, damagePercentMax);
+	}
+
+	//! @param table Compiled table of the loot array, see ExpansionLootTable::Get
+	static void SpawnLoot(EntityAI container, array < ref ExpansionLoot > loot, ExpansionLootTable table, int itemCount, array<EntityAI> spawnedEntities = null, map<string, int> spawnedEntitiesMap = null, bool spawnOnGround = false, float damagePercentMin = 0, float damagePercentMax = 0 )
 	{
 		if (itemCount < 0)
-			itemCount = Math.RandomInt(1, -itemCount);
+			itemCount = RandomInt(1, -itemCount);
 
-		array< float > chances = new array< float >;
+		ExpansionWeightTree weights = table.CreateSampler();
 
 		int lootItemsSpawned = 0;
 
 		//! Spawn min number of items first
-		foreach (ExpansionLoot lootItem: loot)
+		foreach (int i, ExpansionLoot lootItem: loot)
 		{
 			lootItem.m_RemainingChance = lootItem.Chance;
 			lootItem.m_Remaining = lootItem.Max;
@@ -205,14 +215,15 @@ class ExpansionLootSpawner
 				AddItem( container, lootItem, spawnedEntities, spawnedEntitiesMap, spawnOnGround, damagePercentMin, damagePercentMax );
 			}
 
-			chances.Insert(lootItem.m_RemainingChance);
+			if (lootItem.m_RemainingChance == 0)
+				weights.SetWeight(i, 0);
 		}
 
 		//! Spawn remaining items randomly (if any)
 		while ( lootItemsSpawned < itemCount )
 		{
 			//! Chances are treated as weights here, otherwise it wouldn't make sense as we always want a fixed number of items
-			int index = ExpansionStatic.GetWeightedRandom( chances );
+			int index = weights.Pick( s_Random );
 
 			if ( index > -1 )
 			{
@@ -223,7 +234,7 @@ class ExpansionLootSpawner
 				AddItem( container, randomLootItem, spawnedEntities, spawnedEntitiesMap, spawnOnGround, damagePercentMin, damagePercentMax );
 
 				if ( randomLootItem.m_Remaining == 0 )
-					chances[index] = 0;
+					weights.SetWeight( index, 0 );
 			} else
 			{
 				Print("ExpansionLootSpawner::SpawnLoot couldn't select a loot item to spawn (all chances zero?) - items spawned : " + lootItemsSpawned);
@@ -33,6 +33,7 @@ class ExpansionMapWidgetBase: ScriptedWidgetEventHandler
 	protected int m_PrimaryColor;
 	protected int m_HoverColor;
 	protected bool m_MouseHover;
+	protected bool m_Culled;
 
 	void ExpansionMapWidgetBase(Widget parent, MapWidget mapWidget, bool autoInit = true)
 	{
@@ -347,4 +348,39 @@ class ExpansionMapWidgetBase: ScriptedWidgetEventHandler
 	{
 		return true;
 	}
+
+	/**
+	 * @brief Whether the map menu may skip updating this widget while it is outside the visible map area
+	 */
+	bool CanCull()
+	{
+		return false;
+	}
+
+	/**
+	 * @brief Whether this widget may be merged with other widgets in the same screen cell when the map is zoomed out
+	 */
+	bool CanCluster()
+	{
+		return false;
+	}
+
+	//! World position used for viewport culling and clustering
+	vector GetCullPosition()
+	{
+		return m_WorldPosition;
+	}
+
+	void SetCulled(bool state)
+	{
+		if (state && !m_Culled)
+			m_LayoutRoot.Show(false);
+
+		m_Culled = state;
+	}
+
+	bool IsCulled()
+	{
+		return m_Culled;
+	}
 };
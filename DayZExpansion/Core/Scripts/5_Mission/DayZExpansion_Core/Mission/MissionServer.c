@@ -84,6 +84,13 @@ modded class MissionServer
 			EXPrint(this, "Command line parameter exitAfter found - exiting after " + exitAfter + " seconds");
 			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(GetGame().RequestExit, exitAfter.ToInt() * 1000, false, 0);
 		}
+
+		string lootSeed;
+		if (GetCLIParam("expansionLootSeed", lootSeed))
+		{
+			EXPrint(this, "Command line parameter expansionLootSeed found - using seed " + lootSeed + " for loot rolls");
+			ExpansionLootSpawner.SetSeed(lootSeed.ToInt());
+		}
 	}
 	
 	override void OnClientReadyEvent( PlayerIdentity identity, PlayerBase player )
@@ -0,0 +1,200 @@
+/**
+ * ExpansionGarageIndex.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+//! A stored vehicle and the garage it is stored in
+class ExpansionGarageIndexEntry
+{
+	ExpansionGarageData m_Garage;
+	ExpansionGarageVehicleData m_Vehicle;
+
+	void ExpansionGarageIndexEntry(ExpansionGarageData garage, ExpansionGarageVehicleData vehicle)
+	{
+		m_Garage = garage;
+		m_Vehicle = vehicle;
+	}
+}
+
+/**@class		ExpansionGarageIndex
+ * @brief		Server side lookup tables into the loaded garage data
+ *
+ * Garages are indexed by owner UID and territory ID, stored vehicles by global ID and by a coarse grid of their stored position.
+ * The garage module keeps the index in sync whenever garages are added or removed and vehicles are stored, retrieved or dropped,
+ * the index itself only holds weak references to the data owned by the module.
+ **/
+class ExpansionGarageIndex
+{
+	static const float CELL_SIZE = 100.0;
+	static const int CELL_ROW = 1024;  //! Max cells per row, covers maps up to ~100 km
+
+	protected ref map<string, ExpansionGarageData> m_ByOwnerUID;
+	protected ref map<int, ExpansionGarageData> m_ByTerritoryID;
+	protected ref map<string, ref array<ref ExpansionGarageIndexEntry>> m_ByGlobalID;
+	protected ref map<int, ref array<ref ExpansionGarageIndexEntry>> m_Grid;
+
+	void ExpansionGarageIndex()
+	{
+		m_ByOwnerUID = new map<string, ExpansionGarageData>;
+		m_ByTerritoryID = new map<int, ExpansionGarageData>;
+		m_ByGlobalID = new map<string, ref array<ref ExpansionGarageIndexEntry>>;
+		m_Grid = new map<int, ref array<ref ExpansionGarageIndexEntry>>;
+	}
+
+	void Clear()
+	{
+		m_ByOwnerUID.Clear();
+		m_ByTerritoryID.Clear();
+		m_ByGlobalID.Clear();
+		m_Grid.Clear();
+	}
+
+	void AddGarage(ExpansionGarageData garage)
+	{
+		if (garage.m_OwnerUID != string.Empty)
+			m_ByOwnerUID.Insert(garage.m_OwnerUID, garage);
+
+		if (garage.m_TerritoryID > -1)
+			m_ByTerritoryID.Insert(garage.m_TerritoryID, garage);
+
+		foreach (ExpansionGarageVehicleData vehicle: garage.m_Vehicles)
+		{
+			AddVehicle(garage, vehicle);
+		}
+	}
+
+	void RemoveGarage(ExpansionGarageData garage)
+	{
+		if (m_ByOwnerUID[garage.m_OwnerUID] == garage)
+			m_ByOwnerUID.Remove(garage.m_OwnerUID);
+
+		if (m_ByTerritoryID[garage.m_TerritoryID] == garage)
+			m_ByTerritoryID.Remove(garage.m_TerritoryID);
+
+		foreach (ExpansionGarageVehicleData vehicle: garage.m_Vehicles)
+		{
+			RemoveVehicle(garage, vehicle);
+		}
+	}
+
+	void AddVehicle(ExpansionGarageData garage, ExpansionGarageVehicleData vehicle)
+	{
+		if (!vehicle.IsGlobalIDValid())
+			return;
+
+		auto entry = new ExpansionGarageIndexEntry(garage, vehicle);
+
+		string id = ExpansionStatic.IntToHex(vehicle.m_GlobalID);
+		array<ref ExpansionGarageIndexEntry> entries = m_ByGlobalID[id];
+		if (!entries)
+		{
+			entries = new array<ref ExpansionGarageIndexEntry>;
+			m_ByGlobalID.Insert(id, entries);
+		}
+		entries.Insert(entry);
+
+		int cell = GetCell(vehicle.m_Position);
+		entries = m_Grid[cell];
+		if (!entries)
+		{
+			entries = new array<ref ExpansionGarageIndexEntry>;
+			m_Grid.Insert(cell, entries);
+		}
+		entries.Insert(entry);
+	}
+
+	void RemoveVehicle(ExpansionGarageData garage, ExpansionGarageVehicleData vehicle)
+	{
+		if (!vehicle.IsGlobalIDValid())
+			return;
+
+		string id = ExpansionStatic.IntToHex(vehicle.m_GlobalID);
+		if (RemoveEntry(m_ByGlobalID[id], garage, vehicle))
+			m_ByGlobalID.Remove(id);
+
+		int cell = GetCell(vehicle.m_Position);
+		if (RemoveEntry(m_Grid[cell], garage, vehicle))
+			m_Grid.Remove(cell);
+	}
+
+	//! @return true if the list is empty afterwards
+	protected bool RemoveEntry(array<ref ExpansionGarageIndexEntry> entries, ExpansionGarageData garage, ExpansionGarageVehicleData vehicle)
+	{
+		if (!entries)
+			return false;
+
+		for (int i = entries.Count() - 1; i >= 0; i--)
+		{
+			ExpansionGarageIndexEntry entry = entries[i];
+			if (entry.m_Garage == garage && (!entry.m_Vehicle || entry.m_Vehicle == vehicle || entry.m_Vehicle.IsGlobalIDEqual(vehicle)))
+				entries.RemoveOrdered(i);
+		}
+
+		return entries.Count() == 0;
+	}
+
+	ExpansionGarageData GetGarageByOwnerUID(string uid)
+	{
+		return m_ByOwnerUID[uid];
+	}
+
+	ExpansionGarageData GetGarageByTerritoryID(int territoryID)
+	{
+		return m_ByTerritoryID[territoryID];
+	}
+
+	//! @return All garage records with the given global ID (normally at most one), or NULL
+	array<ref ExpansionGarageIndexEntry> GetByGlobalID(TIntArray globalID)
+	{
+		return m_ByGlobalID[ExpansionStatic.IntToHex(globalID)];
+	}
+
+	array<ref ExpansionGarageIndexEntry> GetByGlobalID(string globalIDHex)
+	{
+		return m_ByGlobalID[globalIDHex];
+	}
+
+	/**
+	 * @brief Collect all stored vehicles in grid cells overlapping the given circle
+	 * @note Candidates only, callers still need to check the exact distance
+	 */
+	void GetNearby(vector position, float radius, notnull array<ref ExpansionGarageIndexEntry> results)
+	{
+		int minX = GetCellCoord(position[0] - radius);
+		int maxX = GetCellCoord(position[0] + radius);
+		int minZ = GetCellCoord(position[2] - radius);
+		int maxZ = GetCellCoord(position[2] + radius);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				array<ref ExpansionGarageIndexEntry> entries = m_Grid[x * CELL_ROW + z];
+				if (!entries)
+					continue;
+
+				foreach (ExpansionGarageIndexEntry entry: entries)
+				{
+					results.Insert(entry);
+				}
+			}
+		}
+	}
+
+	static int GetCellCoord(float coord)
+	{
+		return Math.Clamp(Math.Floor(coord / CELL_SIZE), 0, CELL_ROW - 1);
+	}
+
+	static int GetCell(vector position)
+	{
+		return GetCellCoord(position[0]) * CELL_ROW + GetCellCoord(position[2]);
+	}
+}
@@ -31,10 +31,12 @@ class ExpansionGarageModule: CF_ModuleWorld
 	protected ref ExpansionTerritory m_TerritoryTemp;
 	protected ref map<int, ExpansionParkingMeter> m_TerritoryParkingMeters;
 	protected ref array<ExpansionParkingMeter> m_ParkingMeters;
+	protected ref map<int, ref array<ExpansionParkingMeter>> m_ParkingMeterGrid;
 #endif
 	protected ref ScriptInvoker m_GarageMenuInvoker; //! Client
 	protected ref ScriptInvoker m_GarageMenuCallbackInvoker; //! Client
 	protected ref array<ref ExpansionGarageData> m_GarageData;
+	protected ref ExpansionGarageIndex m_GarageIndex;
 
 #ifdef EXPANSIONMODGROUPS
 	protected ref ExpansionPartyModule m_PartyModule;
@@ -93,20 +95,19 @@ class ExpansionGarageModule: CF_ModuleWorld
 
 	bool IsInGarage(CarScript vehicle)
 	{
-		if (vehicle.m_Expansion_GlobalID.IsZero())
+		if (vehicle.m_Expansion_GlobalID.IsZero() || !m_GarageIndex)
 			return false;
 
-		foreach (ExpansionGarageData garageData: m_GarageData)
+		array<ref ExpansionGarageIndexEntry> entries = m_GarageIndex.GetByGlobalID(vehicle.m_Expansion_GlobalID.IDToHex());
+		if (!entries)
+			return false;
+
+		foreach (ExpansionGarageIndexEntry entry: entries)
 		{
-			foreach (ExpansionGarageVehicleData vehicleData: garageData.m_Vehicles)
-			{
-				if (vehicle.m_Expansion_GlobalID.IsEqual(vehicleData.m_GlobalID))
-				{
-					EXPrint(ToString() + "::IsInGarage - " + vehicle.GetType() + " " + vehicle.GetPosition() + " has identical global ID to " + vehicleData.m_ClassName + " " + vehicleData.m_Position + " stored in garage " + garageData.m_OwnerUID);
-					if (vehicle.GetType() == vehicleData.m_ClassName)
-						return true;
-				}
-			}
+			ExpansionGarageVehicleData vehicleData = entry.m_Vehicle;
+			EXPrint(ToString() + "::IsInGarage - " + vehicle.GetType() + " " + vehicle.GetPosition() + " has identical global ID to " + vehicleData.m_ClassName + " " + vehicleData.m_Position + " stored in garage " + entry.m_Garage.m_OwnerUID);
+			if (vehicle.GetType() == vehicleData.m_ClassName)
+				return true;
 		}
 
 		return false;
@@ -118,9 +119,11 @@ class ExpansionGarageModule: CF_ModuleWorld
 		if (GetGame().IsServer() && GetGame().IsMultiplayer())
 		{
 			m_GarageData = new array<ref ExpansionGarageData>;
+			m_GarageIndex = new ExpansionGarageIndex();
 		#ifdef EXPANSIONMODBASEBUILDING
 			m_TerritoryParkingMeters = new map<int, ExpansionParkingMeter>;
 			m_ParkingMeters = new array<ExpansionParkingMeter>;
+			m_ParkingMeterGrid = new map<int, ref array<ExpansionParkingMeter>>;
 		#endif
 
 			CreateDirectoryStructure();
@@ -159,6 +162,7 @@ class ExpansionGarageModule: CF_ModuleWorld
 		{
 			Print(ToString() + "::LoadGarageData - Add data from file:" + path + fileName);
 			m_GarageData.Insert(garageData);
+			m_GarageIndex.AddGarage(garageData);
 		}
 	}
 
@@ -534,7 +538,14 @@ class ExpansionGarageModule: CF_ModuleWorld
 		garageData.Save();
 
 		if (!hasData)
+		{
 			m_GarageData.Insert(garageData);
+			m_GarageIndex.AddGarage(garageData);
+		}
+		else
+		{
+			m_GarageIndex.AddVehicle(garageData, vehicleData);
+		}
 
 		ExpansionNotification(new StringLocaliser("STR_EXPANSION_GARAGE_INFO"), new StringLocaliser("STR_EXPANSION_GARAGE_SUCCESS_STORE", vehicle.GetDisplayName()), ExpansionIcons.GetPath("Exclamationmark"), COLOR_EXPANSION_NOTIFICATION_SUCCESS, 7, ExpansionNotificationType.GARAGE).Create(identity);
 		if (GetExpansionSettings().GetLog().Garage)
@@ -862,6 +873,7 @@ class ExpansionGarageModule: CF_ModuleWorld
 			return;
 		}
 
+		m_GarageIndex.RemoveVehicle(garageData, vehicleData);
 		garageData.RemoveVehicle(vehicleData);
 		garageData.Save();
 
@@ -1016,18 +1028,11 @@ class ExpansionGarageModule: CF_ModuleWorld
 		}
 	#endif
 
-		float vehicleSearchRadiusSq = vehicleSearchRadius * vehicleSearchRadius;
+		array<CarScript> vehicles = new array<CarScript>;
+		ExpansionVehicleGrid.GetNearby(playerPos, vehicleSearchRadius, vehicles);
 
-		auto node = CarScript.s_Expansion_AllVehicles.m_Head;
-		while (node)
+		foreach (CarScript vehicle: vehicles)
 		{
-			auto vehicle = node.m_Value;
-
-			node = node.m_Next;
-
-			if (vector.DistanceSq(vehicle.GetPosition(), playerPos) > vehicleSearchRadiusSq)
-				continue;
-
 			if (!CanStore(player, vehicle))
 				continue;
 
@@ -1076,18 +1081,55 @@ class ExpansionGarageModule: CF_ModuleWorld
 		else
 		{
 			EXTrace.Print(EXTrace.GARAGE, this, "::GetTerritory - player is outside a territory. Trying to find territory with member UID " + playerUID);
-			map<int, TerritoryFlag> flags = m_TerritoryModule.GetAllTerritoryFlags();
-			foreach (int territoryID, TerritoryFlag flag: flags)
+			territory = GetMemberTerritory(player, playerUID);
+			if (territory)
+				return territory;
+
+		#ifdef DIAG
+			EXTrace.Print(EXTrace.GARAGE, this, "::GetTerritory - neither player nor group are members in any territory");
+		#endif
+		}
+
+		return NULL;
+	}
+
+	//! @brief Get 1st territory that player (or their group) is a member of.
+	//! Looked up in the territory module's player UID -> territory IDs index, so no territories need to be scanned.
+	protected ExpansionTerritory GetMemberTerritory(PlayerBase player, string playerUID)
+	{
+		ExpansionTerritory territory = GetFirstIndexedTerritory(playerUID);
+		if (territory)
+			return territory;
+
+	#ifdef EXPANSIONMODGROUPS
+		if (m_PartyDataTemp)
+		{
+			foreach (ExpansionPartyPlayerData partyPlayer: m_PartyDataTemp.GetPlayers())
 			{
-				territory = flag.GetTerritory();
+				if (!partyPlayer || partyPlayer.UID == playerUID)
+					continue;
 
-				if (IsTerritoryMember(player, territory))
+				territory = GetFirstIndexedTerritory(partyPlayer.UID);
+				if (territory)
 					return territory;
 			}
+		}
+	#endif
 
-		#ifdef DIAG
-			EXTrace.Print(EXTrace.GARAGE, this, "::GetTerritory - neither player nor group are members in any territory");
-		#endif
+		return NULL;
+	}
+
+	protected ExpansionTerritory GetFirstIndexedTerritory(string uid)
+	{
+		TIntArray territoryIDs = m_TerritoryModule.GetPlayerTerritoryIDs(uid);
+		if (!territoryIDs)
+			return NULL;
+
+		foreach (int territoryID: territoryIDs)
+		{
+			TerritoryFlag flag = m_TerritoryModule.GetTerritoryFlag(territoryID);
+			if (flag && flag.HasExpansionTerritoryInformation())
+				return flag.GetTerritory();
 		}
 
 		return NULL;
@@ -1161,7 +1203,25 @@ class ExpansionGarageModule: CF_ModuleWorld
 			m_PartyDataTemp = player.Expansion_GetParty();
 	#endif
 
-		foreach (ExpansionGarageData garageData: m_GarageData)
+		//! Only garages with vehicles in retrieve range of the player need to be checked
+		array<ref ExpansionGarageIndexEntry> nearby = new array<ref ExpansionGarageIndexEntry>;
+		m_GarageIndex.GetNearby(player.GetPosition(), GetMaxRetrieveDistance(), nearby);
+
+		array<ExpansionGarageData> garages = new array<ExpansionGarageData>;
+		array<ref array<ExpansionGarageVehicleData>> garagesVehicles = new array<ref array<ExpansionGarageVehicleData>>;
+		foreach (ExpansionGarageIndexEntry entry: nearby)
+		{
+			int index = garages.Find(entry.m_Garage);
+			if (index == -1)
+			{
+				index = garages.Insert(entry.m_Garage);
+				garagesVehicles.Insert(new array<ExpansionGarageVehicleData>);
+			}
+
+			garagesVehicles[index].Insert(entry.m_Vehicle);
+		}
+
+		foreach (int garageIndex, ExpansionGarageData garageData: garages)
 		{
 			bool enemyTerritory = false;
 
@@ -1176,7 +1236,8 @@ class ExpansionGarageModule: CF_ModuleWorld
 			}
 		#endif
 
-			foreach (ExpansionGarageVehicleData vehicleData: garageData.m_Vehicles)
+			array<ExpansionGarageVehicleData> garageVehicles = garagesVehicles[garageIndex];
+			foreach (ExpansionGarageVehicleData vehicleData: garageVehicles)
 			{
 				if (!CanRetrieve(player, vehicleData, enemyTerritory))
 					continue;
@@ -1194,15 +1255,23 @@ class ExpansionGarageModule: CF_ModuleWorld
 		return storedVehicles;
 	}
 
-	protected ExpansionGarageData GetGarageDataByTerritoryID(int territoryID)
+	//! Largest distance from the player at which CanRetrieve can succeed
+	protected float GetMaxRetrieveDistance()
 	{
-		foreach (ExpansionGarageData current: m_GarageData)
-		{
-			if (current.m_TerritoryID == territoryID)
-				return current;
-		}
+		auto settings = GetExpansionSettings().GetGarage();
+		float maxDistance = Math.Max(settings.VehicleSearchRadius, settings.MaxDistanceFromStoredPosition);
 
-		return null;
+	#ifdef EXPANSIONMODBASEBUILDING
+		if (m_ParkingMeters.Count() > 0 || m_TerritoryParkingMeters.Count() > 0)
+			maxDistance = Math.Max(maxDistance, GetMaxParkingMeterRadius());
+	#endif
+
+		return maxDistance;
+	}
+
+	protected ExpansionGarageData GetGarageDataByTerritoryID(int territoryID)
+	{
+		return m_GarageIndex.GetGarageByTerritoryID(territoryID);
 	}
 
 	protected ExpansionGarageData GetGarageDataByVehicleObject(Object vehicleObject)
@@ -1221,19 +1290,15 @@ class ExpansionGarageModule: CF_ModuleWorld
 
 	protected ExpansionGarageData GetGarageDataByGlobalID(TIntArray globalID, out ExpansionGarageVehicleData vehicleData)
 	{
-		foreach (ExpansionGarageData current: m_GarageData)
-		{
-			foreach (ExpansionGarageVehicleData vehicle: current.m_Vehicles)
-			{
-				if (vehicle.IsGlobalIDValid() && vehicle.IsGlobalIDEqual(globalID))
-				{
-					vehicleData = vehicle;
-					return current;
-				}
-			}
-		}
+		if (!globalID || globalID.Count() != 4)
+			return null;
 
-		return null;
+		array<ref ExpansionGarageIndexEntry> entries = m_GarageIndex.GetByGlobalID(globalID);
+		if (!entries || entries.Count() == 0)
+			return null;
+
+		vehicleData = entries[0].m_Vehicle;
+		return entries[0].m_Garage;
 	}
 
 	ScriptInvoker GetGarageMenuSI()
@@ -1320,17 +1385,9 @@ class ExpansionGarageModule: CF_ModuleWorld
 	{
 		auto trace = EXTrace.Start(EXTrace.GARAGE, this);
 
-		for (int i = m_GarageData.Count() - 1; i >= 0; i--)
-		{
-			ExpansionGarageData currentGarageData = m_GarageData[i];
-			if (currentGarageData.m_TerritoryID == territoryID)
-			{
-				DropVehicles(currentGarageData, destroy);
-				m_GarageData.RemoveOrdered(i);
-				DeleteFile(currentGarageData.GetFileName());
-				break;
-			}
-		}
+		ExpansionGarageData garageData = m_GarageIndex.GetGarageByTerritoryID(territoryID);
+		if (garageData)
+			RemoveGarage(garageData, destroy);
 
 	}
 
@@ -1376,68 +1433,73 @@ class ExpansionGarageModule: CF_ModuleWorld
 
 	protected ExpansionGarageData GetGarageDataByOwnerUID(string uid)
 	{
-		foreach (ExpansionGarageData current: m_GarageData)
-		{
-			if (current.m_OwnerUID == uid)
-				return current;
-		}
-
-		return null;
+		return m_GarageIndex.GetGarageByOwnerUID(uid);
 	}
 
 	protected void DropPlayerVehicles(string playerUID, bool destroy = false)
 	{
 		auto trace = EXTrace.Start(EXTrace.GARAGE, this);
 
-		for (int i = m_GarageData.Count() - 1; i >= 0; i--)
-		{
-			ExpansionGarageData currentGarageData = m_GarageData[i];
-			if (currentGarageData.m_OwnerUID == playerUID)
-			{
-				DropVehicles(currentGarageData, destroy);
-				m_GarageData.RemoveOrdered(i);
-				DeleteFile(currentGarageData.GetFileName());
-				break;
-			}
-		}
+		ExpansionGarageData garageData = m_GarageIndex.GetGarageByOwnerUID(playerUID);
+		if (garageData)
+			RemoveGarage(garageData, destroy);
 
 	}
 	
 	void DropParkingMeterVehicles(vector pos, float maxDistance, bool destroy = false)
 	{
 		float maxDistanceSq = maxDistance * maxDistance;
-		foreach (ExpansionGarageData garageData: m_GarageData)
+
+		array<ref ExpansionGarageIndexEntry> nearby = new array<ref ExpansionGarageIndexEntry>;
+		m_GarageIndex.GetNearby(pos, maxDistance, nearby);
+
+		array<ExpansionGarageData> changedGarages = new array<ExpansionGarageData>;
+		foreach (ExpansionGarageIndexEntry entry: nearby)
 		{
-			bool changed;
-			for (int i = garageData.m_Vehicles.Count() - 1; i >= 0; i--)
+			ExpansionGarageData garageData = entry.m_Garage;
+			ExpansionGarageVehicleData storedData = entry.m_Vehicle;
+			if (!garageData || !storedData)
+				continue;
+
+			float currentDistanceSq = vector.DistanceSq(storedData.m_Position, pos);
+			if (storedData.m_Position != vector.Zero && currentDistanceSq <= maxDistanceSq)
 			{
-				ExpansionGarageVehicleData storedData = garageData.m_Vehicles[i];
-				float currentDistanceSq = vector.DistanceSq(storedData.m_Position, pos);
-				if (storedData.m_Position != vector.Zero && currentDistanceSq <= maxDistanceSq)
+				EntityAI loadedEntity;
+				if (LoadVehicle(storedData, loadedEntity, false) && destroy)
 				{
-					EntityAI loadedEntity;
-					if (LoadVehicle(storedData, loadedEntity, false) && destroy)
+					for (int j = 0; j < loadedEntity.GetInventory().AttachmentCount(); j++)
 					{
-						for (int j = 0; j < loadedEntity.GetInventory().AttachmentCount(); j++)
-						{
-							EntityAI attachment = loadedEntity.GetInventory().GetAttachmentFromIndex(j);
-							if (attachment)
-								attachment.SetHealth(0);
-						}
-		
-						loadedEntity.SetHealth(0);
+						EntityAI attachment = loadedEntity.GetInventory().GetAttachmentFromIndex(j);
+						if (attachment)
+							attachment.SetHealth(0);
 					}
-					
-					garageData.m_Vehicles.RemoveOrdered(i);
-					changed = true;
+	
+					loadedEntity.SetHealth(0);
 				}
+				
+				m_GarageIndex.RemoveVehicle(garageData, storedData);
+				garageData.m_Vehicles.RemoveItem(storedData);
+
+				if (changedGarages.Find(garageData) == -1)
+					changedGarages.Insert(garageData);
 			}
-			
-			if (changed)
-				garageData.Save();
+		}
+
+		foreach (ExpansionGarageData changedGarage: changedGarages)
+		{
+			changedGarage.Save();
 		}
 	}
 
+	//! Drop (and optionally destroy) all vehicles of the garage, then forget about it and delete its file
+	protected void RemoveGarage(ExpansionGarageData garageData, bool destroy = false)
+	{
+		DropVehicles(garageData, destroy);
+		m_GarageIndex.RemoveGarage(garageData);
+		DeleteFile(garageData.GetFileName());
+		m_GarageData.RemoveItem(garageData);
+	}
+
 	protected void DropVehicles(ExpansionGarageData garageData, bool destroy = false)
 	{
 		if (garageData)
@@ -1540,27 +1602,79 @@ class ExpansionGarageModule: CF_ModuleWorld
 	
 	void AddParkingMeter(ExpansionParkingMeter parkingMeter)
 	{
+		if (m_ParkingMeters.Find(parkingMeter) > -1)
+			return;
+
 		m_ParkingMeters.Insert(parkingMeter);
+
+		int cell = ExpansionGarageIndex.GetCell(parkingMeter.GetPosition());
+		array<ExpansionParkingMeter> parkingMeters = m_ParkingMeterGrid[cell];
+		if (!parkingMeters)
+		{
+			parkingMeters = new array<ExpansionParkingMeter>;
+			m_ParkingMeterGrid.Insert(cell, parkingMeters);
+		}
+
+		parkingMeters.Insert(parkingMeter);
 	}
 
 	void RemoveParkingMeter(ExpansionParkingMeter pmObject)
 	{
-		foreach (ExpansionParkingMeter pm: m_ParkingMeters)
-		{
-			if (pm == pmObject)
-				m_ParkingMeters.RemoveItem(pm);
-		}
+		m_ParkingMeters.RemoveItem(pmObject);
+
+		int cell = ExpansionGarageIndex.GetCell(pmObject.GetPosition());
+		array<ExpansionParkingMeter> parkingMeters = m_ParkingMeterGrid[cell];
+		if (!parkingMeters)
+			return;
+
+		parkingMeters.RemoveItem(pmObject);
+		if (parkingMeters.Count() == 0)
+			m_ParkingMeterGrid.Remove(cell);
+	}
+
+	//! Largest radius any parking meter can have, depending on its circuit board
+	float GetMaxParkingMeterRadius()
+	{
+		auto settings = GetExpansionSettings().GetGarage();
+
+		float maxRadius = Math.Max(settings.VehicleSearchRadius, settings.MaxRangeTier1);
+		maxRadius = Math.Max(maxRadius, settings.MaxRangeTier2);
+		return Math.Max(maxRadius, settings.MaxRangeTier3);
 	}
 	
 	ExpansionParkingMeter GetParkingMeter(vector pos)
 	{
-		foreach (ExpansionParkingMeter pm: m_ParkingMeters)
+		if (m_ParkingMeterGrid.Count() == 0)
+			return NULL;
+
+		//! Only cells within the largest possible parking meter radius can contain a parking meter covering pos
+		float searchRadius = GetMaxParkingMeterRadius();
+
+		int minX = ExpansionGarageIndex.GetCellCoord(pos[0] - searchRadius);
+		int maxX = ExpansionGarageIndex.GetCellCoord(pos[0] + searchRadius);
+		int minZ = ExpansionGarageIndex.GetCellCoord(pos[2] - searchRadius);
+		int maxZ = ExpansionGarageIndex.GetCellCoord(pos[2] + searchRadius);
+
+		for (int x = minX; x <= maxX; x++)
 		{
-			float maxDistance = pm.GetRadiusByCircuitBoardType();
-			float maxDistanceSq = maxDistance * maxDistance;
-			float currentDistanceSq = vector.DistanceSq(pos, pm.GetPosition());
-			if (currentDistanceSq <= maxDistanceSq)
-				return pm;
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				array<ExpansionParkingMeter> parkingMeters = m_ParkingMeterGrid[x * ExpansionGarageIndex.CELL_ROW + z];
+				if (!parkingMeters)
+					continue;
+
+				foreach (ExpansionParkingMeter pm: parkingMeters)
+				{
+					if (!pm)
+						continue;
+
+					float maxDistance = pm.GetRadiusByCircuitBoardType();
+					float maxDistanceSq = maxDistance * maxDistance;
+					float currentDistanceSq = vector.DistanceSq(pos, pm.GetPosition());
+					if (currentDistanceSq <= maxDistanceSq)
+						return pm;
+				}
+			}
 		}
 		
 		return NULL;
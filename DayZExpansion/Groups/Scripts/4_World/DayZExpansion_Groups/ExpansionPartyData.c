@@ -39,6 +39,10 @@ class ExpansionPartyData
 
 	protected int MoneyDeposited;
 
+	//! Server, identities of online members, rebuilt after members joined or left
+	protected ref array<PlayerIdentity> m_OnlineIdentities;
+	protected bool m_OnlineIdentitiesDirty = true;
+
 	// ------------------------------------------------------------
 	// Expansion ExpansionPartyData Consturctor
 	// ------------------------------------------------------------
@@ -314,6 +318,31 @@ class ExpansionPartyData
 		return false;
 	}
 
+	// ------------------------------------------------------------
+	// Expansion GetOnlineIdentities
+	// Server only, e.g. for sending RPCs to all online members
+	// ------------------------------------------------------------
+	array<PlayerIdentity> GetOnlineIdentities()
+	{
+		if (!m_OnlineIdentities)
+			m_OnlineIdentities = new array<PlayerIdentity>;
+
+		if (m_OnlineIdentitiesDirty)
+		{
+			m_OnlineIdentities.Clear();
+
+			foreach (ExpansionPartyPlayerData member: Players)
+			{
+				if (member.Player && member.Player.GetIdentity())
+					m_OnlineIdentities.Insert(member.Player.GetIdentity());
+			}
+
+			m_OnlineIdentitiesDirty = false;
+		}
+
+		return m_OnlineIdentities;
+	}
+
 	// ------------------------------------------------------------
 	// Expansion GetPlayer
 	// ------------------------------------------------------------
@@ -991,6 +1020,8 @@ class ExpansionPartyData
 
 	void OnJoin(ExpansionPartyPlayerData player)
 	{
+		m_OnlineIdentitiesDirty = true;
+
 		EXPrint(ToString() + "::OnJoin party " + PartyName + " (ID " + PartyID + ") player " + player.Name + " (ID " + player.GetID() + ")");
 	#ifdef EXPANSIONMODNAVIGATION
 		SyncMarkers_RemovePlayer(player);
@@ -1002,6 +1033,8 @@ class ExpansionPartyData
 
 	void OnLeave(ExpansionPartyPlayerData player)
 	{
+		m_OnlineIdentitiesDirty = true;
+
 		EXPrint(ToString() + "::OnLeave party " + PartyName + " (ID " + PartyID + ") player " + player.Name + " (ID " + player.GetID() + ")");
 	#ifdef EXPANSIONMODNAVIGATION
 		SyncMarkers_RemovePlayer(player);
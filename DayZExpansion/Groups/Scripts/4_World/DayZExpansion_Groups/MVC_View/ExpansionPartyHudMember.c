@@ -61,6 +61,9 @@ class ExpansionPartyHudMember: ExpansionScriptViewBase
 		{
 			monitorModule.m_StatsInvoker.Insert(OnDataRecived);
 			monitorModule.m_StatesInvoker.Insert(OnStateDataRecived);
+
+			bool includeStates = GetExpansionSettings().GetParty().ShowHUDMemberStates || GetExpansionSettings().GetParty().ShowHUDMemberStance;
+			monitorModule.Subscribe(m_PlayerPlainID, includeStates);
 		}
 #endif
 		
@@ -74,10 +77,13 @@ class ExpansionPartyHudMember: ExpansionScriptViewBase
 		auto trace = EXTrace.Start(EXTrace.GROUPS, this);
 
 #ifdef EXPANSIONMONITORMODULE
+		ExpansionMonitorModule monitorModule = ExpansionMonitorModule.Cast(CF_ModuleCoreManager.Get(ExpansionMonitorModule));
+		if (monitorModule)
+			monitorModule.Unsubscribe(m_PlayerPlainID);
+
 		if (!GetExpansionSettings().IsLoaded(ExpansionPartySettings))
 			return;
 
-		ExpansionMonitorModule monitorModule = ExpansionMonitorModule.Cast(CF_ModuleCoreManager.Get(ExpansionMonitorModule));
 		if (monitorModule)
 		{
 			monitorModule.m_StatsInvoker.Remove(OnDataRecived);
@@ -366,20 +372,29 @@ class ExpansionPartyHudMember: ExpansionScriptViewBase
 		return 0.5;
 	}
 	
+	//! Stats and states are pushed by the monitor module (subscribed in constructor),
+	//! only the distance needs to be refreshed locally as it also changes when the local player moves
 	void Expansion_Update()
 	{
 	#ifdef EXPANSIONMONITORMODULE
-		if (!GetExpansionSettings().IsLoaded(ExpansionPartySettings))
+		if (!GetExpansionSettings().IsLoaded(ExpansionPartySettings) || !GetExpansionSettings().GetParty().ShowHUDMemberDistance)
+			return;
+
+		if (!GetGame().GetPlayer())
 			return;
 
 		ExpansionMonitorModule monitorModule = ExpansionMonitorModule.Cast(CF_ModuleCoreManager.Get(ExpansionMonitorModule));
-		if (monitorModule)
-		{
-			if (GetExpansionSettings().GetParty().ShowHUDMemberStates || GetExpansionSettings().GetParty().ShowHUDMemberStance)
-				monitorModule.RequestPlayerStatsAndStates(m_PlayerPlainID);
-			else
-				monitorModule.RequestPlayerStats(m_PlayerPlainID);
-		}
+		if (!monitorModule)
+			return;
+
+		ExpansionSyncedPlayerStats player_stats = monitorModule.GetSubscribedStats(m_PlayerPlainID);
+		if (!player_stats || !player_stats.m_HasBaseStats)
+			return;
+
+		float distance = vector.Distance(player_stats.m_Position, GetGame().GetPlayer().GetPosition());
+		float round = Math.Round(distance);
+		m_PartyMemberController.PlayerDistance = round.ToString() + " m";
+		m_PartyMemberController.NotifyPropertyChanged("PlayerDistance");
 	#endif
 	}
 	
@@ -0,0 +1,299 @@
+/**
+ * ExpansionMarketATMStore.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionMarketATMStore
+ * @brief		Server side store for ATM accounts.
+ *
+ * Accounts are loaded on demand (player connect or first lookup) from one small binary file per player
+ * and kept in an in-memory index. Changed accounts are only marked dirty and written in batches,
+ * on disconnect and on mission finish. Legacy JSON accounts are converted the first time they are loaded.
+ * Accounts are written to a temporary file first which only replaces the account file once it is complete,
+ * a temporary file left behind by a crash is preferred on load if it can be read completely.
+ **/
+class ExpansionMarketATMStore
+{
+	static const int VERSION = 1;
+	static const string EXTENSION = ".bin";
+	static const string LEGACY_EXTENSION = ".json";
+	static const string TEMP_EXTENSION = ".tmp";
+
+	static const int FLUSH_INTERVAL = 5000;  //! ms between writes of dirty accounts
+	static const int MAX_OFFLINE_ACCOUNTS = 256;  //! Accounts of offline players (e.g. party owners) kept in memory, least recently used are evicted first
+
+	protected ref map<string, ref ExpansionMarketATM_Data> m_Accounts;
+	protected ref array<string> m_Dirty;
+	protected ref set<string> m_Online;
+	protected ref array<string> m_OfflineLRU;
+
+	void ExpansionMarketATMStore()
+	{
+		m_Accounts = new map<string, ref ExpansionMarketATM_Data>;
+		m_Dirty = new array<string>;
+		m_Online = new set<string>;
+		m_OfflineLRU = new array<string>;
+	}
+
+	void ~ExpansionMarketATMStore()
+	{
+		if (GetGame())
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Flush);
+	}
+
+	void Start()
+	{
+		if (!FileExist(EXPANSION_ATM_FOLDER))
+			ExpansionStatic.MakeDirectoryRecursive(EXPANSION_ATM_FOLDER);
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Flush, FLUSH_INTERVAL, true);
+	}
+
+	void Stop()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Flush);
+
+		Flush();
+
+		m_Accounts.Clear();
+		m_Online.Clear();
+		m_OfflineLRU.Clear();
+	}
+
+	/**
+	 * @brief Get account of player with the given UID, loading (and if needed converting) it from disk if it isn't in memory yet
+	 * @return account or NULL if the player has none
+	 */
+	ExpansionMarketATM_Data Get(string id)
+	{
+		ExpansionMarketATM_Data data = m_Accounts.Get(id);
+		if (data)
+		{
+			Touch(id);
+			return data;
+		}
+
+		data = Load(id);
+		if (!data)
+			return NULL;
+
+		m_Accounts.Insert(id, data);
+		Touch(id);
+
+		return data;
+	}
+
+	ExpansionMarketATM_Data Create(string id, int moneyDeposited)
+	{
+		ExpansionMarketATM_Data data = new ExpansionMarketATM_Data;
+		data.m_FileName = id;
+		data.PlayerID = id;
+		data.MoneyDeposited = moneyDeposited;
+
+		m_Accounts.Insert(id, data);
+		Touch(id);
+		MarkDirty(data);
+
+		return data;
+	}
+
+	//! Account of a connected player, stays in memory until OnDisconnect
+	void OnConnect(string id)
+	{
+		m_Online.Insert(id);
+
+		int index = m_OfflineLRU.Find(id);
+		if (index > -1)
+			m_OfflineLRU.RemoveOrdered(index);
+	}
+
+	//! Write account if needed and drop it from memory
+	void OnDisconnect(string id)
+	{
+		int index = m_Online.Find(id);
+		if (index > -1)
+			m_Online.Remove(index);
+
+		ExpansionMarketATM_Data data = m_Accounts.Get(id);
+		if (!data)
+			return;
+
+		if (data.m_IsDirty)
+			Write(data);
+
+		Evict(id);
+	}
+
+	void MarkDirty(ExpansionMarketATM_Data data)
+	{
+		if (data.m_IsDirty)
+			return;
+
+		data.m_IsDirty = true;
+		m_Dirty.Insert(data.PlayerID);
+	}
+
+	//! Write all dirty accounts
+	void Flush()
+	{
+		if (m_Dirty.Count() == 0)
+			return;
+
+		foreach (string id: m_Dirty)
+		{
+			ExpansionMarketATM_Data data = m_Accounts.Get(id);
+			if (data && data.m_IsDirty)
+				Write(data);
+		}
+
+		m_Dirty.Clear();
+	}
+
+	int Count()
+	{
+		return m_Accounts.Count();
+	}
+
+	int DirtyCount()
+	{
+		return m_Dirty.Count();
+	}
+
+	protected void Touch(string id)
+	{
+		if (m_Online.Find(id) > -1)
+			return;
+
+		int index = m_OfflineLRU.Find(id);
+		if (index > -1)
+			m_OfflineLRU.RemoveOrdered(index);
+
+		m_OfflineLRU.Insert(id);
+
+		while (m_OfflineLRU.Count() > MAX_OFFLINE_ACCOUNTS)
+		{
+			string oldest = m_OfflineLRU[0];
+			ExpansionMarketATM_Data data = m_Accounts.Get(oldest);
+			if (data && data.m_IsDirty)
+				Write(data);
+
+			Evict(oldest);
+		}
+	}
+
+	protected void Evict(string id)
+	{
+		int index = m_OfflineLRU.Find(id);
+		if (index > -1)
+			m_OfflineLRU.RemoveOrdered(index);
+
+		m_Accounts.Remove(id);
+	}
+
+	protected ExpansionMarketATM_Data Load(string id)
+	{
+		string path = EXPANSION_ATM_FOLDER + id + EXTENSION;
+		string tempPath = path + TEMP_EXTENSION;
+
+		//! Interrupted write, the temporary file is newer if it is complete, otherwise the account file is still intact
+		if (FileExist(tempPath))
+		{
+			ExpansionMarketATM_Data recovered = Read(id, tempPath);
+			if (!recovered && FileExist(path))
+				recovered = Read(id, path);
+
+			if (recovered)
+			{
+				EXPrint(ToString() + "::Load - Recovered ATM account " + id + " after interrupted write");
+				Write(recovered);
+				return recovered;
+			}
+
+			DeleteFile(tempPath);
+		}
+
+		if (FileExist(path))
+			return Read(id, path);
+
+		//! One-time conversion of the previous JSON format
+		string legacyPath = EXPANSION_ATM_FOLDER + id + LEGACY_EXTENSION;
+		if (FileExist(legacyPath))
+		{
+			ExpansionMarketATM_Data data = ExpansionMarketATM_Data.Load(id);
+			if (data.PlayerID == string.Empty)
+				data.PlayerID = id;
+
+			if (Write(data))
+			{
+				DeleteFile(legacyPath);
+				EXPrint(ToString() + "::Load - Converted ATM account " + id + " to binary format");
+			}
+
+			return data;
+		}
+
+		return NULL;
+	}
+
+	protected ExpansionMarketATM_Data Read(string id, string path)
+	{
+		FileSerializer file = new FileSerializer();
+		if (!file.Open(path, FileMode.READ))
+		{
+			Error(ToString() + "::Read - Could not open " + path);
+			return NULL;
+		}
+
+		ExpansionMarketATM_Data data = new ExpansionMarketATM_Data;
+		data.m_FileName = id;
+
+		int version;
+		if (!file.Read(version) || !data.OnRead(file, version))
+		{
+			Error(ToString() + "::Read - Could not read " + path);
+			file.Close();
+			return NULL;
+		}
+
+		file.Close();
+
+		return data;
+	}
+
+	protected bool Write(ExpansionMarketATM_Data data)
+	{
+		string path = EXPANSION_ATM_FOLDER + data.m_FileName + EXTENSION;
+		string tempPath = path + TEMP_EXTENSION;
+
+		FileSerializer file = new FileSerializer();
+		if (!file.Open(tempPath, FileMode.WRITE))
+		{
+			Error(ToString() + "::Write - Could not write ATM account " + data.m_FileName);
+			return false;
+		}
+
+		file.Write(VERSION);
+		data.OnWrite(file);
+		file.Close();
+
+		//! Account file is only replaced once the new one is complete, the temporary file is kept if that fails
+		if ((FileExist(path) && !DeleteFile(path)) || !CopyFile(tempPath, path))
+		{
+			Error(ToString() + "::Write - Could not replace ATM account " + data.m_FileName);
+			return false;
+		}
+
+		DeleteFile(tempPath);
+
+		data.m_IsDirty = false;
+
+		return true;
+	}
+}
@@ -17,6 +17,9 @@ class ExpansionMarketATM_Data
 	
 	[NonSerialized()]
 	string m_FileName;
+
+	[NonSerialized()]
+	bool m_IsDirty;
 	
 	int GetMoney()
 	{
@@ -33,6 +36,7 @@ class ExpansionMarketATM_Data
 		MoneyDeposited += amount;
 	}
 	
+	//! Legacy JSON account, only used to convert it to the binary format of ExpansionMarketATMStore
 	static ExpansionMarketATM_Data Load(string name)
 	{
 		ExpansionMarketATM_Data data = new ExpansionMarketATM_Data;
@@ -44,8 +48,28 @@ class ExpansionMarketATM_Data
 		return data;
 	}
 	
+	//! Mark account as changed, it will be written by ExpansionMarketATMStore on its next flush
 	void Save()
 	{
-		JsonFileLoader<ExpansionMarketATM_Data>.JsonSaveFile(EXPANSION_ATM_FOLDER + m_FileName + ".json", this);
+		ExpansionMarketModule module = ExpansionMarketModule.GetInstance();
+		if (module && module.GetATMStore())
+			module.GetATMStore().MarkDirty(this);
+	}
+
+	void OnWrite(ParamsWriteContext ctx)
+	{
+		ctx.Write(PlayerID);
+		ctx.Write(MoneyDeposited);
+	}
+
+	bool OnRead(ParamsReadContext ctx, int version)
+	{
+		if (!ctx.Read(PlayerID))
+			return false;
+
+		if (!ctx.Read(MoneyDeposited))
+			return false;
+
+		return true;
 	}
 }
@@ -209,7 +209,7 @@ class ExpansionMarketModule: CF_ModuleWorld
 	
 	protected ExpansionTraderObjectBase m_OpenedClientTrader;
 	
-	ref array<ref ExpansionMarketATM_Data> m_ATMData;
+	ref ExpansionMarketATMStore m_ATMStore;
 
 	ref map<string, ExpansionMarketItem> m_AmmoItems;
 
@@ -233,7 +233,7 @@ class ExpansionMarketModule: CF_ModuleWorld
 
 		m_ClientMarketZone = new ExpansionMarketClientTraderZone;
 
-		m_ATMData = new array<ref ExpansionMarketATM_Data>;
+		m_ATMStore = new ExpansionMarketATMStore;
 	}
 	
 	static ExpansionMarketModule GetInstance()
@@ -250,6 +250,7 @@ class ExpansionMarketModule: CF_ModuleWorld
 
 		EnableMissionStart();
 		EnableInvokeConnect();
+		EnableClientDisconnect();
 		EnableMissionFinish();
 		EnableMissionLoaded();
 		Expansion_EnableRPCManager();
@@ -294,14 +295,7 @@ class ExpansionMarketModule: CF_ModuleWorld
 		
 		if (!IsMissionClient() && IsMissionHost())
 		{
-			if (!FileExist(EXPANSION_ATM_FOLDER))
-			{
-				ExpansionStatic.MakeDirectoryRecursive(EXPANSION_ATM_FOLDER);
-			}
-			else if (FileExist(EXPANSION_ATM_FOLDER))
-			{
-				LoadATMData();
-			}
+			LoadATMData();
 		}
 		
 		if (IsMissionClient() && !IsMissionHost())
@@ -336,6 +330,30 @@ class ExpansionMarketModule: CF_ModuleWorld
 			return;
 		
 		LoadMoneyPrice();
+		PrewarmConfigCache();
+	}
+
+	//! Resolve config root and inheritance of all market items up front, so price, skin and filter lookups during trading are cached
+	void PrewarmConfigCache()
+	{
+		auto trace = EXTrace.Start(EXTrace.MARKET, this);
+
+		ExpansionMarketSettings market = GetExpansionSettings().GetMarket();
+		if (!market.MarketSystemEnabled)
+			return;
+
+		TStringArray classNames = new TStringArray;
+		map<int, ref ExpansionMarketCategory> categories = market.GetCategories();
+		foreach (int categoryID, ExpansionMarketCategory category: categories)
+		{
+			foreach (ExpansionMarketItem marketItem: category.Items)
+			{
+				classNames.Insert(marketItem.ClassName);
+			}
+		}
+
+		ExpansionConfigCache.Prewarm(classNames);
+		ExpansionConfigCache.PrintStats();
 	}
 	
 	// ------------------------------------------------------------
@@ -1016,23 +1034,23 @@ class ExpansionMarketModule: CF_ModuleWorld
 		if (!trader.Items.Contains(itemClassName))
 		{
 			bool isCfgVehicleSkin;
-			if (GetGame().ConfigIsExisting("CfgVehicles " + itemClassName + " skinBase"))
+			if (ExpansionConfigCache.IsExisting("CfgVehicles", itemClassName, "skinBase"))
 				isCfgVehicleSkin = true;
 			bool isCfgWeaponSkin;
-			if (!isCfgVehicleSkin && GetGame().ConfigIsExisting("CfgWeapons " + itemClassName + " skinBase"))
+			if (!isCfgVehicleSkin && ExpansionConfigCache.IsExisting("CfgWeapons", itemClassName, "skinBase"))
 				isCfgWeaponSkin = true;
 			bool isCfgMagazineSkin;
-			if (!isCfgVehicleSkin && !isCfgWeaponSkin && GetGame().ConfigIsExisting("CfgMagazines " + itemClassName + " skinBase"))
+			if (!isCfgVehicleSkin && !isCfgWeaponSkin && ExpansionConfigCache.IsExisting("CfgMagazines", itemClassName, "skinBase"))
 				isCfgMagazineSkin = true;
 
 			if (isCfgVehicleSkin || isCfgWeaponSkin || isCfgMagazineSkin)
 			{
 				if (isCfgVehicleSkin)
-					GetGame().ConfigGetText("CfgVehicles " + itemClassName + " skinBase", itemClassName);
+					itemClassName = ExpansionConfigCache.GetText("CfgVehicles", itemClassName, "skinBase");
 				else if (isCfgWeaponSkin)
-					GetGame().ConfigGetText("CfgWeapons " + itemClassName + " skinBase", itemClassName);
+					itemClassName = ExpansionConfigCache.GetText("CfgWeapons", itemClassName, "skinBase");
 				else if (isCfgMagazineSkin)
-					GetGame().ConfigGetText("CfgMagazines " + itemClassName + " skinBase", itemClassName);
+					itemClassName = ExpansionConfigCache.GetText("CfgMagazines", itemClassName, "skinBase");
 
 				itemClassName.ToLower();
 			}
@@ -2099,12 +2117,28 @@ class ExpansionMarketModule: CF_ModuleWorld
 			return;
 		
 		SendMoneyDenominations(cArgs.Identity);
+
+		m_ATMStore.OnConnect(cArgs.Identity.GetId());
 		
 		if (!GetPlayerATMData(cArgs.Identity.GetId()))
 		{
 			CreateATMData(cArgs.Identity);
 		}
 	}
+
+	// -----------------------------------------------------------
+	// Expansion OnClientDisconnect
+	// -----------------------------------------------------------
+	override void OnClientDisconnect(Class sender, CF_EventArgs args)
+	{
+		auto trace = EXTrace.Start(EXTrace.MARKET, this);
+
+		super.OnClientDisconnect(sender, args);
+
+		auto cArgs = CF_EventPlayerDisconnectedArgs.Cast(args);
+
+		m_ATMStore.OnDisconnect(cArgs.UID);
+	}
 #endif
 	
 	// -----------------------------------------------------------
@@ -3714,56 +3748,39 @@ class ExpansionMarketModule: CF_ModuleWorld
 	}
 	
 	// ------------------------------------------------------------
-	// Expansion GetATMData
+	// Expansion GetATMStore
 	// ------------------------------------------------------------	
-	array<ref ExpansionMarketATM_Data> GetATMData()
+	ExpansionMarketATMStore GetATMStore()
 	{
-		return m_ATMData;
+		return m_ATMStore;
 	}
 	
 	// ------------------------------------------------------------
 	// Expansion GetPlayerATMData
 	// ------------------------------------------------------------		
+	//! Accounts are loaded on demand, so this also works for players that are offline
 	ExpansionMarketATM_Data GetPlayerATMData(string id)
 	{
-		array<ref ExpansionMarketATM_Data> data = GetATMData();
-		foreach (ExpansionMarketATM_Data currentData : data)
-		{
-			if (currentData && currentData.PlayerID == id)
-				return currentData;
-		}
-		
-		return NULL;
+		return m_ATMStore.Get(id);
 	}
 	
 	// ------------------------------------------------------------
 	// Expansion LoadATMData
 	// ------------------------------------------------------------
+	//! Accounts are no longer loaded all at once, this only starts the store which loads them when players connect.
+	//! Started regardless of ATMSystemEnabled as accounts are still created on connect while the ATM system is disabled.
 	void LoadATMData()
 	{
-		if (!GetExpansionSettings().GetMarket().ATMSystemEnabled)
-			return;
-
-		array<string> files = ExpansionStatic.FindFilesInLocation(EXPANSION_ATM_FOLDER, ".json");
-		
-		foreach (string fileName : files)
-		{
-			//! Strip '.json' extension
-			fileName = fileName.Substring(0, fileName.Length() - 5);
-			ExpansionMarketATM_Data data = ExpansionMarketATM_Data.Load(fileName);
-			m_ATMData.Insert(data);
-		}
+		m_ATMStore.Start();
 	}
 	
 	// ------------------------------------------------------------
 	// Expansion SaveATMData
 	// ------------------------------------------------------------
+	//! Writes accounts that changed since the last flush
 	void SaveATMData()
 	{
-		foreach (ExpansionMarketATM_Data atmData: m_ATMData)
-		{
-			atmData.Save();
-		}
+		m_ATMStore.Stop();
 	}
 	
 	
@@ -3772,15 +3789,7 @@ class ExpansionMarketModule: CF_ModuleWorld
 	// ------------------------------------------------------------
 	void CreateATMData(PlayerIdentity ident)
 	{
-		ExpansionMarketATM_Data newData = new ExpansionMarketATM_Data;
-		newData.m_FileName = ident.GetId();
-		newData.PlayerID = ident.GetId();
-			
-		newData.MoneyDeposited = GetExpansionSettings().GetMarket().DefaultDepositMoney;
-		
-		newData.Save();
-		
-		m_ATMData.Insert(newData);
+		m_ATMStore.Create(ident.GetId(), GetExpansionSettings().GetMarket().DefaultDepositMoney);
 	}
 	
 	// ------------------------------------------------------------
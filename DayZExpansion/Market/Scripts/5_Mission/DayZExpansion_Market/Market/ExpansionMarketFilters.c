@@ -182,10 +182,12 @@ class ExpansionMarketFilters
 	
 	void GenerateAttachmentsMapFromPath(out map<string, ref TStringArray> currentMap, string path)
 	{
-		for (int i = 0; i < GetGame().ConfigGetChildrenCount(path); i++) 
+		int count = GetGame().ConfigGetChildrenCount(path);
+		for (int i = 0; i < count; i++) 
 		{
 			string item_name;
 			GetGame().ConfigGetChildName(path, i, item_name);
+			//! One-shot scan over all classes, deliberately not cached
 			switch (GetGame().ConfigGetType(path + " " + item_name + " inventorySlot")) 
 			{
 				case CT_ARRAY: 
@@ -397,30 +399,27 @@ class ExpansionMarketFilters
 		return GetGame().ConfigIsExisting("CfgWeapons " + className);
 	}
 
-	//! Fucking SLOW. Use with care.
+	//! Inheritance is looked up once per class and cached in ExpansionConfigCache
 	static bool ClassNameHierarchyContains(string className, string cfgPath, TStringArray validBaseNames, string stopAt = "Inventory_Base")
 	{
-		string baseName = className;
-		string baseNameLower;
+		string stopAtLower = stopAt;
+		stopAtLower.ToLower();
+
+		TStringArray hierarchy = ExpansionConfigCache.GetHierarchy(cfgPath, className);
 
 		//! Traverse max 10 levels up the inheritance tree
-		for (int i = 0; i < 10; i++)
+		int count = Math.Min(hierarchy.Count(), 10);
+		for (int i = 0; i < count; i++)
 		{
-			baseNameLower = baseName;
-			baseNameLower.ToLower();
+			string baseNameLower = hierarchy[i];
+			if (i > 0 && (baseNameLower == "all" || baseNameLower == stopAtLower))
+				return false;
 
 			foreach (string validBase: validBaseNames)
 			{
 				if (baseNameLower.Contains(validBase))
 					return true;
 			}
-
-			GetGame().ConfigGetBaseName(cfgPath + " " + className, baseName);
-
-			if (baseName == "All" || baseName == stopAt)
-				return false;
-
-			className = baseName;
 		}
 
 		return false;
@@ -35,7 +35,7 @@ class ExpansionMissionEventBase
 	protected string m_FileName;
 
 	[NonSerialized()]
-	protected float m_CurrentMissionTime;
+	protected float m_StartTime;	//! Tick time in seconds when the mission timer started
 
 	[NonSerialized()]
 	private bool m_IsRunning;
@@ -181,9 +181,17 @@ class ExpansionMissionEventBase
 	// ------------------------------------------------------------
 	float GetElapsedTime()
 	{
-		return m_CurrentMissionTime;
+		return GetGame().GetTickTime() - m_StartTime;
 	}
 
+	// ------------------------------------------------------------
+	// ExpansionMissionEventBase ResetElapsedTime
+	// ------------------------------------------------------------
+	//! Restart the mission timer, the mission module picks up the new end time when the old one is due
+	void ResetElapsedTime()
+	{
+		m_StartTime = GetGame().GetTickTime();
+	}
 	
 	// ------------------------------------------------------------
 	// ExpansionMissionEventBase GetElapsedTime
@@ -191,12 +199,22 @@ class ExpansionMissionEventBase
 	// Missions can end before the max time runs out so this may not be the right option for you
 	float GetMaxRemainingTime()
 	{
-		return MissionMaxTime - m_CurrentMissionTime;
+		return MissionMaxTime - GetElapsedTime();
+	}
+	
+	// ------------------------------------------------------------
+	// ExpansionMissionEventBase NeedsUpdate
+	// ------------------------------------------------------------
+	//! Return true if Event_OnUpdate has to be called every second while the mission is running
+	bool NeedsUpdate()
+	{
+		return false;
 	}
 	
 	// ------------------------------------------------------------
 	// ExpansionMissionEventBase Start
 	// ------------------------------------------------------------
+	//! Updates and the end of the mission are scheduled by ExpansionMissionModule
 	void Start()
 	{
 		#ifdef EXPANSION_MISSION_EVENT_DEBUG
@@ -206,11 +224,9 @@ class ExpansionMissionEventBase
 		if ( GetGame().IsServer() )
 		{
 			m_IsRunning = true;
-			m_CurrentMissionTime = 0;
+			m_StartTime = GetGame().GetTickTime();
 	
 			Event_OnStart();
-	
-			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( OnUpdate, 1000, true, 1.0 );
 		}
 	}
 	
@@ -230,8 +246,6 @@ class ExpansionMissionEventBase
 		
 		if ( GetGame().IsServer() )
 		{
-			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( OnUpdate );
-	
 			SI_OnMissionEnd.Invoke( this );
 	
 			m_IsRunning = false;
@@ -247,14 +261,7 @@ class ExpansionMissionEventBase
 	{
 		if ( GetGame().IsServer() )
 		{
-			m_CurrentMissionTime += delta;
-	
 			Event_OnUpdate( delta );
-	
-			if ( m_CurrentMissionTime >= MissionMaxTime && CanEnd() )
-			{
-				End();
-			}
 		}
 	}
 	
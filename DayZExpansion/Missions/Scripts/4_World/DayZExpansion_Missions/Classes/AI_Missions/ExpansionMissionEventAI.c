@@ -288,11 +288,16 @@ class ExpansionMissionEventAI: ExpansionMissionEventBase
 		}
 	}
 
+	override bool NeedsUpdate()
+	{
+		return true;
+	}
+
 	override void Event_OnUpdate( float delta )
 	{
 		if ( IsMissionHost() )
 		{
-			if (m_CurrentMissionTime >= MissionMaxTime && !m_MissionEnd)
+			if (GetElapsedTime() >= MissionMaxTime && !m_MissionEnd)
 			{
 				m_MissionEnd = true;
 
@@ -210,6 +210,11 @@ class ExpansionMissionEventAirdrop: ExpansionMissionEventBase
 		}
 	}
 	
+	override bool NeedsUpdate()
+	{
+		return true;
+	}
+	
 	// ------------------------------------------------------------
 	// Expansion Event_OnUpdate
 	// ------------------------------------------------------------
@@ -230,12 +235,12 @@ class ExpansionMissionEventAirdrop: ExpansionMissionEventBase
 					
 					if ( m_Container )
 					{
-						m_CurrentMissionTime = 0;
+						ResetElapsedTime();
 					}
 				}
 			}
 
-			if (m_CurrentMissionTime >= MissionMaxTime && m_Container && m_Container.GetHealth("", "") > 0.0)
+			if (GetElapsedTime() >= MissionMaxTime && m_Container && m_Container.GetHealth("", "") > 0.0)
 			{
 				m_Container.SetHealth("", "", 0.0);
 				m_Container.SetLifetimeMax(0.0);
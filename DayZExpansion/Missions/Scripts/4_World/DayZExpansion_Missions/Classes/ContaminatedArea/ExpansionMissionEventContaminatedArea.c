@@ -72,6 +72,11 @@ class ExpansionMissionEventContaminatedArea: ExpansionMissionEventBase
 		GetGame().ObjectDelete(m_Entity);
 	}
 
+	override bool NeedsUpdate()
+	{
+		return true;
+	}
+
 	override void Event_OnUpdate(float delta)
 	{
 		if (GetMaxRemainingTime() < FinishDecayLifetime)
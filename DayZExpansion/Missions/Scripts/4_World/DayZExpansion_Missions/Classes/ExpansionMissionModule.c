@@ -18,13 +18,29 @@ class ExpansionMissionModule: CF_ModuleWorld
 	static ref ScriptInvoker SI_Started = new ScriptInvoker();
 	static ref ScriptInvoker SI_Ended = new ScriptInvoker();
 
+	static const int SCHEDULER_INTERVAL = 1000;	//! ms between scheduler ticks, i.e. resolution of all mission timers
+	static const int RETRY_INTERVAL = 10000;	//! ms between start attempts while missions are missing or player count is too low
+	static const int SPAWN_BUDGET = 5;			//! ms per scheduler tick spent on starting (spawning) queued missions, at least one is started
+
+	static const int EVENT_CHECK_START = 1;		//! StartNewMissions
+	static const int EVENT_START = 2;			//! StartNewMissionsInternal
+	static const int EVENT_UPDATE = 3;			//! UpdateMission, rescheduled every tick while a mission that needs updates is running
+	static const int EVENT_END = 4;				//! CheckMissionEnd, due when the mission timer runs out
+
 	private autoptr array< ref ExpansionMissionEventBase > m_Missions;
-	private autoptr ref array< float > m_AvailableMissions;
 	private autoptr map< typename, ref array< ExpansionMissionEventBase > > m_MissionsTyped;
 
+	//! Selection weights parallel to m_Missions, zero while a mission is running or queued to start.
+	//! One tree over all missions is enough as the only limits (MinMissions/MaxMissions) apply to all types together,
+	//! and a pick weighted over all missions is what a type-then-mission pick would have to reproduce anyway.
+	private ref ExpansionWeightTree m_MissionWeights;
+
 	private autoptr map< string, typename > m_MissionTypes;
-	
-	private bool m_lowPlayerCheckRunning;
+
+	private ref ExpansionTimingWheel m_Scheduler;
+	private ref array< ref ExpansionTimingWheelEntry > m_DueEvents;
+	private autoptr array< ExpansionMissionEventBase > m_PendingStarts;
+	private bool m_SchedulerRunning;
 
 	//! Local reference to the actual settings, this is handled by the GC 
 	private ExpansionMissionSettings m_MissionSettings;
@@ -52,10 +68,10 @@ class ExpansionMissionModule: CF_ModuleWorld
 
 		ExpansionSettings.SI_Mission.Remove( OnSettingsUpdated );
 
-		if(m_lowPlayerCheckRunning)
+		if ( m_SchedulerRunning && GetGame() )
 		{
-			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove(StartNewMissions);
-			m_lowPlayerCheckRunning = false;
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( OnSchedulerTick );
+			m_SchedulerRunning = false;
 		}
 
 		SI_OnMissionEnd.Remove( RemoveMission );
@@ -74,7 +90,11 @@ class ExpansionMissionModule: CF_ModuleWorld
 
 		m_Missions = new array< ref ExpansionMissionEventBase >;
 
-		m_AvailableMissions = new ref array< float >;
+		m_MissionWeights = new ExpansionWeightTree();
+
+		m_Scheduler = new ExpansionTimingWheel( SCHEDULER_INTERVAL );
+		m_DueEvents = new array< ref ExpansionTimingWheelEntry >;
+		m_PendingStarts = new array< ExpansionMissionEventBase >;
 
 		m_MissionsTyped = new map< typename, ref array< ExpansionMissionEventBase > >;
 
@@ -162,6 +182,14 @@ class ExpansionMissionModule: CF_ModuleWorld
 
 		ProcessMissions();
 
+		RebuildMissionWeights();
+
+		if ( !m_SchedulerRunning )
+		{
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( OnSchedulerTick, SCHEDULER_INTERVAL, true );
+			m_SchedulerRunning = true;
+		}
+
 		StartNewMissions();
 	}
 	
@@ -241,6 +269,152 @@ class ExpansionMissionModule: CF_ModuleWorld
 		}
 	}
 	
+	// ------------------------------------------------------------
+	// ExpansionMissionModule RebuildMissionWeights
+	// ------------------------------------------------------------
+	//! Precompute selection weights, only needs to run when missions are added or removed
+	protected void RebuildMissionWeights()
+	{
+		array< float > weights = new array< float >;
+
+		foreach ( ExpansionMissionEventBase mission: m_Missions )
+		{
+			if ( mission.IsRunning() || m_PendingStarts.Find( mission ) > -1 )
+				weights.Insert( 0 );
+			else
+				weights.Insert( mission.Weight );
+		}
+
+		m_MissionWeights.Build( weights );
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule SetMissionAvailable
+	// ------------------------------------------------------------
+	protected void SetMissionAvailable( ExpansionMissionEventBase mission, bool available )
+	{
+		int index = m_Missions.Find( mission );
+		if ( index < 0 )
+			return;
+
+		if ( available )
+			m_MissionWeights.SetWeight( index, mission.Weight );
+		else
+			m_MissionWeights.SetWeight( index, 0 );
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule ScheduleEvent
+	// ------------------------------------------------------------
+	protected void ScheduleEvent( int evt, int delay )
+	{
+		m_Scheduler.Schedule( delay, evt );
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule OnSchedulerTick
+	// ------------------------------------------------------------
+	//! Single timer driving all mission scheduling, nothing is iterated unless an event is due
+	protected void OnSchedulerTick()
+	{
+		m_Scheduler.Advance( m_DueEvents );
+
+		foreach ( ExpansionTimingWheelEntry entry: m_DueEvents )
+		{
+			OnSchedulerEvent( entry.m_Event, entry.m_Target );
+		}
+
+		m_DueEvents.Clear();
+
+		if ( m_PendingStarts.Count() > 0 )
+			ProcessPendingStarts();
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule OnSchedulerEvent
+	// ------------------------------------------------------------
+	protected void OnSchedulerEvent( int evt, Class target )
+	{
+		switch ( evt )
+		{
+			case EVENT_CHECK_START:
+				StartNewMissions();
+				break;
+
+			case EVENT_START:
+				StartNewMissionsInternal();
+				break;
+
+			case EVENT_UPDATE:
+				UpdateMission( ExpansionMissionEventBase.Cast( target ) );
+				break;
+
+			case EVENT_END:
+				CheckMissionEnd( ExpansionMissionEventBase.Cast( target ) );
+				break;
+		}
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule UpdateMission
+	// ------------------------------------------------------------
+	protected void UpdateMission( ExpansionMissionEventBase mission )
+	{
+		if ( !mission || !mission.IsRunning() )
+			return;
+
+		mission.OnUpdate( SCHEDULER_INTERVAL / 1000.0 );
+
+		if ( mission.IsRunning() )
+			m_Scheduler.Schedule( SCHEDULER_INTERVAL, EVENT_UPDATE, mission );
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule CheckMissionEnd
+	// ------------------------------------------------------------
+	protected void CheckMissionEnd( ExpansionMissionEventBase mission )
+	{
+		if ( !mission || !mission.IsRunning() )
+			return;
+
+		//! Mission timer may have been restarted since (e.g. airdrop container landed)
+		float remaining = mission.GetMaxRemainingTime();
+		if ( remaining > 0 )
+		{
+			m_Scheduler.Schedule( remaining * 1000, EVENT_END, mission );
+			return;
+		}
+
+		if ( mission.CanEnd() )
+			mission.End();
+		else
+			m_Scheduler.Schedule( SCHEDULER_INTERVAL, EVENT_END, mission );
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule ProcessPendingStarts
+	// ------------------------------------------------------------
+	//! Start queued missions until the spawn budget of this tick is used up
+	protected void ProcessPendingStarts()
+	{
+		auto trace = EXTrace.Start(EXTrace.MISSIONS, this, "" + m_PendingStarts.Count());
+
+		int ticks = TickCount(0);
+
+		while ( m_PendingStarts.Count() > 0 )
+		{
+			ExpansionMissionEventBase mission = m_PendingStarts[0];
+			m_PendingStarts.RemoveOrdered( 0 );
+
+			if ( mission && !mission.IsRunning() )
+				StartMissionInternal( mission );
+
+			//! TickCount is in 100 ns units
+			if ( TickCount( ticks ) >= SPAWN_BUDGET * 10000 )
+				break;
+		}
+	}
+
 	// ------------------------------------------------------------
 	// ExpansionMissionModule ProcessMission
 	// ------------------------------------------------------------
@@ -299,7 +473,6 @@ class ExpansionMissionModule: CF_ModuleWorld
 			{
 				missionEvent.LoadDefault( j );
 				m_Missions.Insert( missionEvent );
-				m_AvailableMissions.Insert( missionEvent.Weight );
 
 				ExpansionMissionMeta missionMeta = new ExpansionMissionMeta;
 
@@ -362,7 +535,6 @@ class ExpansionMissionModule: CF_ModuleWorld
 
 			m_MissionSettings.Missions.Insert( missionMeta );
 
-			m_AvailableMissions.Insert( missionEvent.Weight );
 			m_Missions.Insert( missionEvent );
 		}
 	}
@@ -391,20 +563,11 @@ class ExpansionMissionModule: CF_ModuleWorld
 			//! If player count is too low
 			if ( playerCount < m_MissionSettings.MinPlayersToStartMissions )
 			{
-				if( !m_lowPlayerCheckRunning )
-				{
-					GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( StartNewMissions, 10000, true );
-					m_lowPlayerCheckRunning = true;
-				}
+				if ( !m_Scheduler.IsScheduled( EVENT_CHECK_START ) )
+					ScheduleEvent( EVENT_CHECK_START, RETRY_INTERVAL );
 
 				return;
 			}
-
-			if( m_lowPlayerCheckRunning )
-			{
-				GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove(StartNewMissions);
-				m_lowPlayerCheckRunning = false;
-			}
 		}
 	#endif
 		
@@ -417,7 +580,7 @@ class ExpansionMissionModule: CF_ModuleWorld
 			m_InitialMission = true;
 			delay = m_MissionSettings.InitialMissionStartDelay;
 		}
-		GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( StartNewMissionsInternal, delay, false );
+		ScheduleEvent( EVENT_START, delay );
 	}
 
 	void StartNewMissionsInternal()
@@ -427,19 +590,21 @@ class ExpansionMissionModule: CF_ModuleWorld
 		if ( m_Missions.Count() == 0 )
 			return;
 
-		if ( m_RunningMissions.Count() < m_MissionSettings.MaxMissions )
+		//! Missions queued to start count as running
+		int running = m_RunningMissions.Count() + m_PendingStarts.Count();
+		if ( running < m_MissionSettings.MaxMissions )
 		{
 			bool skip;
-			if ( m_RunningMissions.Count() > m_MissionSettings.MinMissions )
+			if ( running > m_MissionSettings.MinMissions )
 			{
-				float chance = ExpansionMath.LinearConversion(m_MissionSettings.MaxMissions, m_MissionSettings.MinMissions, m_RunningMissions.Count()) + 0.125;
+				float chance = ExpansionMath.LinearConversion(m_MissionSettings.MaxMissions, m_MissionSettings.MinMissions, running) + 0.125;
 
 				if ( chance < Math.RandomFloatInclusive(0.0,1.0) )
 					skip = true;
 			}
-			if ( skip || (FindNewMission() && m_RunningMissions.Count() < m_MissionSettings.MaxMissions) )
+			if ( skip || (FindNewMission() && m_RunningMissions.Count() + m_PendingStarts.Count() < m_MissionSettings.MaxMissions) )
 			{
-				GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( StartNewMissionsInternal, 10000, false );
+				ScheduleEvent( EVENT_START, RETRY_INTERVAL );
 			}
 		}
 	}
@@ -451,6 +616,14 @@ class ExpansionMissionModule: CF_ModuleWorld
 	{
 		return m_RunningMissions.Count();
 	}
+
+	// ------------------------------------------------------------
+	// ExpansionMissionModule GetNumberPendingMissions
+	// ------------------------------------------------------------
+	int GetNumberPendingMissions()
+	{
+		return m_PendingStarts.Count();
+	}
 	
 	// ------------------------------------------------------------
 	// ExpansionMissionModule RemoveMission
@@ -462,12 +635,15 @@ class ExpansionMissionModule: CF_ModuleWorld
 #endif
 	
 		m_RunningMissions.RemoveItem( mission );
+
+		m_Scheduler.Cancel( EVENT_UPDATE, mission );
+		m_Scheduler.Cancel( EVENT_END, mission );
 		
-		m_AvailableMissions[m_Missions.Find(mission)] = mission.Weight;
+		SetMissionAvailable( mission, true );
 
 		SI_Ended.Invoke( mission );
 
-		GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( StartNewMissions, m_MissionSettings.TimeBetweenMissions, false );
+		ScheduleEvent( EVENT_CHECK_START, m_MissionSettings.TimeBetweenMissions );
 	}
 	
 	// ------------------------------------------------------------
@@ -477,16 +653,17 @@ class ExpansionMissionModule: CF_ModuleWorld
 	{
 		auto trace = EXTrace.Start(EXTrace.MISSIONS, this);
 		
-		int index = ExpansionStatic.GetWeightedRandom( m_AvailableMissions );
+		int index = m_MissionWeights.Pick();
 
 		EXTrace.Print(EXTrace.MISSIONS, this, "Selected mission index " + index);
 
 		if ( index > -1 )
 		{
-			EXTrace.Print(EXTrace.MISSIONS, this, "Selected mission " + m_Missions[ index ].MissionName + " - weight: " + m_AvailableMissions[index] );
-			
-			StartMissionInternal( m_Missions[ index ] );
-			m_AvailableMissions[index] = 0;
+			EXTrace.Print(EXTrace.MISSIONS, this, "Selected mission " + m_Missions[ index ].MissionName + " - weight: " + m_MissionWeights.GetWeight( index ) );
+
+			//! Actual start (spawning) happens on the next scheduler tick within the spawn budget
+			m_PendingStarts.Insert( m_Missions[ index ] );
+			m_MissionWeights.SetWeight( index, 0 );
 			return true;
 		}
 
@@ -509,6 +686,8 @@ class ExpansionMissionModule: CF_ModuleWorld
 		m_MissionSettings.Missions.Insert( missionMeta );
 
 		ProcessMission( evt );
+
+		RebuildMissionWeights();
 	}
 	
 	// ------------------------------------------------------------
@@ -520,12 +699,20 @@ class ExpansionMissionModule: CF_ModuleWorld
 		if ( idx < 0 )
 			return false;
 
+		//! Scheduled update and end events only hold a weak reference to the mission, end it while it is still known
+		if ( evt.IsRunning() )
+			evt.End();
+
 		m_Missions.Remove( idx );
 
 		idx = m_MissionSettings.Missions.Find( evt.m_MissionMeta );
 		if ( idx >= 0 )
 			m_MissionSettings.Missions.Remove( idx );
 
+		m_PendingStarts.RemoveItem( evt );
+
+		RebuildMissionWeights();
+
 		return true;
 	}
 	
@@ -534,10 +721,17 @@ class ExpansionMissionModule: CF_ModuleWorld
 	// ------------------------------------------------------------
 	private void StartMissionInternal( ExpansionMissionEventBase mission )
 	{
+		SetMissionAvailable( mission, false );
+
 		mission.Start();
 
 		m_RunningMissions.Insert( mission );
 
+		m_Scheduler.Schedule( mission.MissionMaxTime * 1000, EVENT_END, mission );
+
+		if ( mission.NeedsUpdate() )
+			m_Scheduler.Schedule( SCHEDULER_INTERVAL, EVENT_UPDATE, mission );
+
 		SI_Started.Invoke( mission );
 	}
 	
@@ -552,6 +746,8 @@ class ExpansionMissionModule: CF_ModuleWorld
 		if ( m_Missions.Find( mission ) < 0 )
 			return false;
 
+		m_PendingStarts.RemoveItem( mission );
+
 		StartMissionInternal( mission );
 
 		return true;
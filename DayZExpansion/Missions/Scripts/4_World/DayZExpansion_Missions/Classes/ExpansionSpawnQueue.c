@@ -0,0 +1,229 @@
+/**
+ * ExpansionSpawnQueue.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+class ExpansionSpawnRequest
+{
+	ExpansionSpawnWave m_Wave;
+	string m_Type;
+	vector m_Position;
+	int m_Index;		//! 1-based index in wave
+	int m_SpawnTime;	//! GetGame().GetTime() at which the object should be spawned
+
+	void ExpansionSpawnRequest(ExpansionSpawnWave wave, string type, vector position, int index, int spawnTime)
+	{
+		m_Wave = wave;
+		m_Type = type;
+		m_Position = position;
+		m_Index = index;
+		m_SpawnTime = spawnTime;
+	}
+}
+
+/**@class		ExpansionSpawnWave
+ * @brief		A group of spawn requests from one source (e.g. infected around an airdrop container)
+ *
+ * Owners subclass this to create and set up the spawned objects and keep a strong reference to it.
+ * Once the owner drops the wave, its pending requests are discarded by the queue.
+ **/
+class ExpansionSpawnWave
+{
+	int m_Requested;
+	int m_Spawned;
+
+	//! Create the object for a request, default just creates the requested type
+	Object Spawn(ExpansionSpawnRequest request)
+	{
+		return GetGame().CreateObject(request.m_Type, request.m_Position, false, ExpansionConfigCache.IsKindOf(request.m_Type, "DZ_LightAI"));
+	}
+
+	//! Called for each processed request, obj is NULL if spawning failed
+	void OnSpawned(ExpansionSpawnRequest request, Object obj)
+	{
+	}
+
+	//! Called once after the last request of the wave was processed
+	void OnComplete()
+	{
+	}
+
+	bool IsComplete()
+	{
+		return m_Requested > 0 && m_Spawned >= m_Requested;
+	}
+}
+
+/**@class		ExpansionSpawnQueue
+ * @brief		Shared server side queue for staggered object spawns (airdrop infected, hordes)
+ *
+ * Requests are kept ordered by spawn time and processed from a per-frame update that only runs while requests are pending,
+ * spending at most FRAME_BUDGET ms per frame so big waves are spread over several frames instead of causing a hitch.
+ * Keeps queue depth and spawn latency (time between requested and actual spawn) for diagnostics, printed after each completed wave when mission tracing is enabled.
+ **/
+class ExpansionSpawnQueue
+{
+	static const int FRAME_BUDGET = 2;  //! ms per frame, at least one due request is processed per frame
+
+	protected static ref array<ref ExpansionSpawnRequest> s_Requests = new array<ref ExpansionSpawnRequest>;
+	protected static bool s_Updating;
+
+	static int s_Spawned;
+	static int s_Failed;
+	static int s_Discarded;
+	static int s_MaxDepth;
+	static int s_TotalLatency;
+	static int s_MaxLatency;
+
+	/**
+	 * @brief Queue spawn of an object
+	 * @param delay ms from now
+	 */
+	static ExpansionSpawnRequest Enqueue(ExpansionSpawnWave wave, string type, vector position, int delay = 0)
+	{
+		wave.m_Requested++;
+
+		auto request = new ExpansionSpawnRequest(wave, type, position, wave.m_Requested, GetGame().GetTime() + delay);
+
+		//! Binary search for insert position, requests with equal spawn time stay in enqueue order
+		int low = 0;
+		int high = s_Requests.Count();
+		while (low < high)
+		{
+			int mid = (low + high) / 2;
+			if (s_Requests[mid].m_SpawnTime <= request.m_SpawnTime)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+
+		s_Requests.InsertAt(request, low);
+
+		if (s_Requests.Count() > s_MaxDepth)
+			s_MaxDepth = s_Requests.Count();
+
+		if (!s_Updating)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Insert(Update);
+			s_Updating = true;
+		}
+
+		return request;
+	}
+
+	static void Update(float timeslice)
+	{
+		int time = GetGame().GetTime();
+		int ticks = TickCount(0);
+
+		//! Requests are ordered by spawn time, only look at the due ones
+		while (s_Requests.Count() > 0 && s_Requests[0].m_SpawnTime <= time)
+		{
+			ExpansionSpawnRequest request = s_Requests[0];
+			s_Requests.RemoveOrdered(0);
+
+			if (!request.m_Wave)
+			{
+				s_Discarded++;
+				continue;
+			}
+
+			Process(request, time);
+
+			//! TickCount is in 100 ns units
+			if (TickCount(ticks) >= FRAME_BUDGET * 10000)
+				break;
+		}
+
+		if (s_Requests.Count() == 0)
+			Stop();
+	}
+
+	protected static void Process(ExpansionSpawnRequest request, int time)
+	{
+		ExpansionSpawnWave wave = request.m_Wave;
+
+		Object obj = wave.Spawn(request);
+		if (obj)
+			s_Spawned++;
+		else
+			s_Failed++;
+
+		int latency = time - request.m_SpawnTime;
+		s_TotalLatency += latency;
+		if (latency > s_MaxLatency)
+			s_MaxLatency = latency;
+
+		wave.m_Spawned++;
+		wave.OnSpawned(request, obj);
+
+		if (wave.IsComplete())
+		{
+			wave.OnComplete();
+
+			if (EXTrace.MISSIONS)
+				PrintStats();
+		}
+	}
+
+	//! Discard all pending requests of a wave
+	static void Cancel(ExpansionSpawnWave wave)
+	{
+		for (int i = s_Requests.Count() - 1; i >= 0; i--)
+		{
+			if (s_Requests[i].m_Wave == wave)
+			{
+				s_Requests.RemoveOrdered(i);
+				s_Discarded++;
+			}
+		}
+
+		if (s_Requests.Count() == 0)
+			Stop();
+	}
+
+	protected static void Stop()
+	{
+		if (!s_Updating)
+			return;
+
+		GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(Update);
+		s_Updating = false;
+	}
+
+	static int Count()
+	{
+		return s_Requests.Count();
+	}
+
+	static float GetAverageLatency()
+	{
+		int processed = s_Spawned + s_Failed;
+		if (processed == 0)
+			return 0;
+
+		return s_TotalLatency / (processed * 1.0);
+	}
+
+	static void ResetStats()
+	{
+		s_Spawned = 0;
+		s_Failed = 0;
+		s_Discarded = 0;
+		s_MaxDepth = s_Requests.Count();
+		s_TotalLatency = 0;
+		s_MaxLatency = 0;
+	}
+
+	static void PrintStats()
+	{
+		EXPrint("[ExpansionSpawnQueue] Pending: " + s_Requests.Count() + " | Max depth: " + s_MaxDepth + " | Spawned: " + s_Spawned + " | Failed: " + s_Failed + " | Discarded: " + s_Discarded + " | Avg latency: " + GetAverageLatency() + " ms | Max latency: " + s_MaxLatency + " ms");
+	}
+}
@@ -1,3 +1,22 @@
+//! Horde infected, spawned through ExpansionSpawnQueue
+class ExpansionHordeSpawnWave: ExpansionSpawnWave
+{
+	ExpansionMissionEventHorde m_Mission;
+
+	void ExpansionHordeSpawnWave(ExpansionMissionEventHorde mission)
+	{
+		m_Mission = mission;
+	}
+
+	override Object Spawn(ExpansionSpawnRequest request)
+	{
+		if (!m_Mission || !m_Mission.IsRunning())
+			return null;
+
+		return m_Mission.CreateSingleInfected(request.m_Type);
+	}
+}
+
 class ExpansionMissionEventHorde: ExpansionMissionEventBase
 {
 	int MinInfectedAmount;
@@ -16,6 +35,9 @@ class ExpansionMissionEventHorde: ExpansionMissionEventBase
 	[NonSerialized()]
 	AIGroup m_AIGroup;
 
+	[NonSerialized()]
+	ref ExpansionHordeSpawnWave m_SpawnWave;
+
 	// ------------------------------------------------------------
 	// Expansion ExpansionMissionEventHorde
 	// ------------------------------------------------------------
@@ -54,13 +76,13 @@ class ExpansionMissionEventHorde: ExpansionMissionEventBase
 		CF_Log.Debug("ExpansionMissionEventHorde::Event_OnStart - TargetInfectedAmount is "+TargetInfectedAmount);
 		CF_Log.Debug("ExpansionMissionEventHorde::Event_OnStart - MaxInfectedAmount is "+MaxInfectedAmount);
 
-		while ( m_Infected.Count() < TargetInfectedAmount )
-		{
-			int index = m_Infected.Count() + 1;
-
-			SpawnInfectedRemaining( Position, MinimumSpawnRadius, MaximumSpawnRadius, TargetInfectedAmount );
+		//! Spawn (incl. navmesh sampling) is spread over frames by the spawn queue
+		m_SpawnWave = new ExpansionHordeSpawnWave( this );
 
-			m_Infected.Remove( index );
+		TStringArray zombieClasses = ExpansionStatic.GetWorkingZombieClasses();
+		for ( int i = 0; i < TargetInfectedAmount; i++ )
+		{
+			ExpansionSpawnQueue.Enqueue( m_SpawnWave, zombieClasses.GetRandomElement(), Position );
 		}
 	
 		CreateNotification( new StringLocaliser( "STR_EXPANSION_MISSION_HORDE_SPAWNED", MissionName ), "set:expansion_notification_iconset image:icon_bandit", 7 );
@@ -73,6 +95,12 @@ class ExpansionMissionEventHorde: ExpansionMissionEventBase
 		auto trace = CF_Trace_0(ExpansionTracing.MISSIONS, this, "Event_OnEnd");
 #endif
 
+		if ( m_SpawnWave )
+		{
+			ExpansionSpawnQueue.Cancel( m_SpawnWave );
+			m_SpawnWave = NULL;
+		}
+
 		while ( m_Infected.Count() > 0 )
 		{
 			int index = m_Infected.Count() - 1;
@@ -206,18 +234,15 @@ class ExpansionMissionEventHorde: ExpansionMissionEventBase
 		return fname;
 	}
 
-	protected void SpawnInfectedRemaining( vector centerPosition, float innerRadius, float spawnRadius, int remaining )
+	Object CreateSingleInfected( string type )
 	{
 #ifdef EXPANSIONTRACE
-		auto trace = CF_Trace_0(ExpansionTracing.MISSIONS, this, "SpawnInfectedRemaining");
+		auto trace = CF_Trace_0(ExpansionTracing.MISSIONS, this, "CreateSingleInfected");
 #endif
-		
-		if ( remaining <= 0 )
-			return;
 
-		vector spawnPosition = SampleSpawnPosition( centerPosition, spawnRadius, innerRadius );
+		vector spawnPosition = SampleSpawnPosition( Position, MaximumSpawnRadius, MinimumSpawnRadius );
 
-		Object obj = GetGame().CreateObject( ExpansionStatic.GetWorkingZombieClasses().GetRandomElement(), spawnPosition, false, false, true );
+		Object obj = GetGame().CreateObject( type, spawnPosition, false, false, true );
 
 		DayZCreatureAI creature;
 		Class.CastTo( creature, obj );
@@ -228,8 +253,7 @@ class ExpansionMissionEventHorde: ExpansionMissionEventBase
 			m_Infected.Insert( obj );
 		}
 
-		//SpawnInfectedRemaining( centerPosition, innerRadius, spawnRadius, remaining - 1 );
-		// GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Call( this.SpawnInfectedRemaining, centerPosition, innerRadius, spawnRadius, remaining - 1 );
+		return obj;
 	}
 
 	protected vector SampleSpawnPosition( vector position, float maxRadius, float innerRadius )
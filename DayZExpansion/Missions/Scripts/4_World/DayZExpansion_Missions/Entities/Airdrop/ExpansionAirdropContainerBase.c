@@ -38,6 +38,10 @@ class ExpansionAirdropContainerBase: Container_Base
 	//! Particle
 	Particle m_ParticleEfx;
 
+	//! Client, infected spawn particles received in one RPC per wave, played at their due time
+	protected ref TVectorArray m_PendingSpawnParticles;
+	protected ref TIntArray m_PendingSpawnParticleTimes;
+
 	vector m_SpawnPosition;  //! @note position where container is spawned, not necessarily where it lands!
 
 #ifdef EXPANSIONMODAI
@@ -127,6 +131,9 @@ class ExpansionAirdropContainerBase: Container_Base
 		
 		StopSmokeEffect();
 
+		if ( m_PendingSpawnParticles && GetGame() )
+			GetGame().GetCallQueue( CALL_CATEGORY_GAMEPLAY ).Remove( UpdatePendingSpawnParticles );
+
 		if ( IsMissionHost() )
 			ExpansionAirdropContainerManagers.DeferredCleanup();
 	}
@@ -557,11 +564,50 @@ class ExpansionAirdropContainerBase: Container_Base
 
 	void RPC_SpawnParticle(PlayerIdentity sender, ParamsReadContext ctx)
 	{
-		vector spawnPos;
-		if (!ctx.Read( spawnPos ))
+		TVectorArray positions;
+		if (!ctx.Read( positions ))
 			return;
-		
-		SpawnParticle( spawnPos );
+
+		TIntArray delays;
+		if (!ctx.Read( delays ) || delays.Count() != positions.Count())
+			return;
+
+		if ( !m_PendingSpawnParticles )
+		{
+			m_PendingSpawnParticles = new TVectorArray;
+			m_PendingSpawnParticleTimes = new TIntArray;
+		}
+
+		bool wasEmpty = m_PendingSpawnParticles.Count() == 0;
+
+		int time = GetGame().GetTime();
+		foreach (int i, vector spawnPos: positions)
+		{
+			m_PendingSpawnParticles.Insert( spawnPos );
+			m_PendingSpawnParticleTimes.Insert( time + delays[i] );
+		}
+
+		if ( wasEmpty )
+			GetGame().GetCallQueue( CALL_CATEGORY_GAMEPLAY ).CallLater( UpdatePendingSpawnParticles, 100, true );
+	}
+
+	protected void UpdatePendingSpawnParticles()
+	{
+		int time = GetGame().GetTime();
+
+		for (int i = m_PendingSpawnParticles.Count() - 1; i >= 0; i--)
+		{
+			if ( m_PendingSpawnParticleTimes[i] > time )
+				continue;
+
+			SpawnParticle( m_PendingSpawnParticles[i] );
+
+			m_PendingSpawnParticles.Remove( i );
+			m_PendingSpawnParticleTimes.Remove( i );
+		}
+
+		if ( m_PendingSpawnParticles.Count() == 0 )
+			GetGame().GetCallQueue( CALL_CATEGORY_GAMEPLAY ).Remove( UpdatePendingSpawnParticles );
 	}
 
 	protected void SpawnParticle( vector spawnPos )
@@ -10,6 +10,32 @@
  *
 */
 
+//! Infected around an airdrop container, spawned through ExpansionSpawnQueue
+class ExpansionAirdropInfectedWave: ExpansionSpawnWave
+{
+	ExpansionAirdropContainerManager m_Manager;
+
+	void ExpansionAirdropInfectedWave(ExpansionAirdropContainerManager manager)
+	{
+		m_Manager = manager;
+	}
+
+	override Object Spawn(ExpansionSpawnRequest request)
+	{
+		if (!m_Manager)
+			return null;
+
+		return m_Manager.CreateSingleInfected(request.m_Type, request.m_Position);
+	}
+
+	override void OnComplete()
+	{
+		//! Periodic noise at container to attract Infected
+		if (m_Manager)
+			m_Manager.StartUpdateNoise();
+	}
+}
+
 /**@class		ExpansionAirdropContainerManager
  * @brief		Keeps track of Infected and server marker associated to airdrop container. Removes them if container gets deleted.
  **/
@@ -19,6 +45,7 @@ class ExpansionAirdropContainerManager
 	vector m_ContainerPosition;
 	protected autoptr array< Object > m_Infected;
 	protected int m_InfectedCount;
+	protected ref ExpansionAirdropInfectedWave m_SpawnWave;
 
 	#ifdef EXPANSIONMODNAVIGATION
 	ExpansionMarkerModule m_MarkerModule;
@@ -34,6 +61,7 @@ class ExpansionAirdropContainerManager
 	protected ref NoiseParams m_NoisePar;
 	protected NoiseSystem m_NoiseSystem;
 	float m_NoiseTickTime;
+	protected bool m_IsUpdatingNoise;
 
 	void ExpansionAirdropContainerManager( ExpansionAirdropContainerBase container, TStringArray infected, int infectedCount )
 	{
@@ -73,6 +101,12 @@ class ExpansionAirdropContainerManager
 
 		Print("[ExpansionAirdropContainerManager] Container at " + m_ContainerPosition + " was deleted");
 
+		if ( m_SpawnWave )
+		{
+			ExpansionSpawnQueue.Cancel( m_SpawnWave );
+			m_SpawnWave = NULL;
+		}
+
 		RemoveServerMarker();
 		RemoveInfected();
 	}
@@ -144,12 +178,12 @@ class ExpansionAirdropContainerManager
 			GetGame().ObjectDelete( infected );
 	}
 
-	void Send_SpawnParticle( string spawnPosStr )
+	//! Send spawn particles of a whole wave in one RPC, clients play them after the given delays
+	void Send_SpawnParticles( TVectorArray positions, TIntArray delays )
 	{
-		vector spawnPos = spawnPosStr.ToVector();
-
 		auto rpc = ExpansionScriptRPC.Create(ExpansionAirdropContainerBase.s_Expansion_SpawnParticle_RPCID);
-		rpc.Write( spawnPos );
+		rpc.Write( positions );
+		rpc.Write( delays );
 		PlayerBase.Expansion_SendNear(rpc, m_Container.GetPosition(), 1000.0, m_Container, true);
 	}
 
@@ -159,6 +193,12 @@ class ExpansionAirdropContainerManager
 		auto trace = EXTrace.Start(EXTrace.MISSIONS, this);
 		#endif
 
+		if ( !m_SpawnWave )
+			m_SpawnWave = new ExpansionAirdropInfectedWave( this );
+
+		TVectorArray particlePositions = new TVectorArray;
+		TIntArray particleDelays = new TIntArray;
+
 		while ( m_InfectedCount < InfectedCount ) 
 		{
 			m_InfectedCount++;
@@ -166,24 +206,23 @@ class ExpansionAirdropContainerManager
 			vector spawnPos = ExpansionMath.GetRandomPointInRing(m_Container.GetPosition(), InfectedSpawnRadius * 0.1, InfectedSpawnRadius);
 			spawnPos[1] = GetGame().SurfaceY( spawnPos[0], spawnPos[2] );
 
-			//! Have to convert vector to string for call queue
-
 			int additionalDelay;
 			if ( InfectedSpawnInterval > 0 )
 			{
-				GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( Send_SpawnParticle, InfectedSpawnInterval * m_InfectedCount, false, spawnPos.ToString( false ) );
+				particlePositions.Insert( spawnPos );
+				particleDelays.Insert( InfectedSpawnInterval * m_InfectedCount );
 				additionalDelay = Math.RandomFloat(100, 300);
 			}
 
-			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( CreateSingleInfected, InfectedSpawnInterval * m_InfectedCount + additionalDelay, false, spawnPos.ToString( false ), m_InfectedCount );
+			ExpansionSpawnQueue.Enqueue( m_SpawnWave, Infected.GetRandomElement(), spawnPos, InfectedSpawnInterval * m_InfectedCount + additionalDelay );
 		}
+
+		if ( particlePositions.Count() > 0 )
+			Send_SpawnParticles( particlePositions, particleDelays );
 	}
 
-	void CreateSingleInfected( string spawnPosStr, int count )
+	Object CreateSingleInfected( string type, vector spawnPos )
 	{
-		vector spawnPos = spawnPosStr.ToVector();
-		string type = Infected.GetRandomElement();
-
 #ifdef ENFUSION_AI_PROJECT
 		bool isAI = type.IndexOf("eAI_Survivor") == 0;
 		TStringArray parts();
@@ -196,7 +235,7 @@ class ExpansionAirdropContainerManager
 #endif
 
 		//! TODO: Create Z slightly in ground to give effect as if they emerge from underground? Also, is there a way to affect Z stance (crouching)?
-		Object obj = GetGame().CreateObject( type, spawnPos, false, GetGame().IsKindOf(type, "DZ_LightAI") );
+		Object obj = GetGame().CreateObject( type, spawnPos, false, ExpansionConfigCache.IsKindOf(type, "DZ_LightAI") );
 
 		if ( obj )
 		{
@@ -226,8 +265,17 @@ class ExpansionAirdropContainerManager
 			Print("[ExpansionAirdropContainerManager] Warning : '" + type + "' is not a valid type!");
 		}
 
-		if (count == InfectedCount)  //! Periodic noise at container to attract Infected
-			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(UpdateNoise, 1000, true);
+		return obj;
+	}
+
+	//! Every completed infected wave calls this, only one noise timer may run
+	void StartUpdateNoise()
+	{
+		if (m_IsUpdatingNoise)
+			return;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(UpdateNoise, 1000, true);
+		m_IsUpdatingNoise = true;
 	}
 
 	//! Make "noise" around the container which AI like Infected will "hear" and get alerted by
@@ -249,6 +297,8 @@ class ExpansionAirdropContainerManager
 	{
 		if (GetGame())
 			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(UpdateNoise);
+
+		m_IsUpdatingNoise = false;
 	}
 
 	void CreateServerMarker()
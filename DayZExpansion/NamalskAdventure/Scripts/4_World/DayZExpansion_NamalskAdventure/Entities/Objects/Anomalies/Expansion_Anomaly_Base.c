@@ -57,6 +57,8 @@ class Expansion_Anomaly_Base: ItemBase
 
 	protected bool m_DelayVFX = true;
 	protected float m_IdleParticleDelay;
+	protected bool m_Expansion_VFXActive;  //! Camera is in range, see ExpansionAnomalyVFXManager
+	bool m_Expansion_VFXQueued;
 
 	protected ExpansionAnomalyTriggerBase m_AnomalyTrigger;
 	protected Expansion_AnomalyCore_Base m_AnomalyCore;
@@ -86,6 +88,10 @@ class Expansion_Anomaly_Base: ItemBase
 	#endif
 
 		m_Expansion_AnomalyNode = s_Expansion_AllAnomalies.Add(this);
+
+		#ifndef SERVER
+		ExpansionAnomalyVFXManager.Start();
+		#endif
 		
 		#ifdef SERVER
 		m_LootConfig = new array <ref ExpansionLoot>;
@@ -159,6 +165,8 @@ class Expansion_Anomaly_Base: ItemBase
 		#endif
 	
 		#ifndef SERVER
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(CreateIdleParticle);
+
 		if (m_ParticleIdle)
 			ParticleIdleStop();
 
@@ -243,7 +251,8 @@ class Expansion_Anomaly_Base: ItemBase
 
 		if (!particle && GetGame() && (!GetGame().IsDedicatedServer()))
 		{
-			particle = Particle.PlayOnObject(particle_type, this, "0 0 0");
+			//! Pooled, particles of anomalies going in and out of range are reused instead of recreated
+			particle = ParticleManager.GetInstance().PlayOnObject(particle_type, this, "0 0 0");
 			return true;
 		}
 
@@ -381,7 +390,56 @@ class Expansion_Anomaly_Base: ItemBase
 	#endif
 		ExDebugPrint("::UpdateVisualState - Anomaly state is: " + typename.EnumToString(ExpansionAnomalyState, state));
 
-		GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Call(UpdateAnomalyVFX_Deferred, state);
+		//! Out of range anomalies pick up their current state when activated
+		if (m_Expansion_VFXActive)
+			ExpansionAnomalyVFXManager.Enqueue(this);
+	}
+
+	bool Expansion_IsVFXActive()
+	{
+		return m_Expansion_VFXActive;
+	}
+
+	//! @note: Called by ExpansionAnomalyVFXManager when the camera got in range or the state of an active anomaly changed.
+	void Expansion_ActivateVFX()
+	{
+	#ifdef EXPANSION_NAMALSK_ADVENTURE_DEBUG
+		auto trace = EXTrace.Start(EXTrace.NAMALSKADVENTURE, this);
+	#endif
+
+		m_Expansion_VFXActive = true;
+
+		if (m_VisualState != m_AnonmalyState)
+			UpdateAnomalyVFX_Deferred(m_AnonmalyState);
+	}
+
+	//! @note: Called by ExpansionAnomalyVFXManager when the camera is out of range.
+	void Expansion_DeactivateVFX()
+	{
+	#ifdef EXPANSION_NAMALSK_ADVENTURE_DEBUG
+		auto trace = EXTrace.Start(EXTrace.NAMALSKADVENTURE, this);
+	#endif
+
+		m_Expansion_VFXActive = false;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(CreateIdleParticle);
+
+		ParticleIdleStop();
+		ParticleActivatedStop();
+
+		if (m_Sound)
+		{
+			SoundStop();
+			m_Sound = null;
+		}
+
+		if (m_Light)
+		{
+			GetGame().ObjectDelete(m_Light);
+			m_Light = null;
+		}
+
+		m_VisualState = ExpansionAnomalyState.NONE;
 	}
 
 	//! @note: This method updates the anomaly visual effects (VFX) in a deferred manner based on the provided `state`.
@@ -403,6 +461,9 @@ class Expansion_Anomaly_Base: ItemBase
 		ParticleIdleStop();
 		ParticleActivatedStop();
 
+		//! No activation burst for a state change that happened while the anomaly was out of range
+		bool transition = m_VisualState != ExpansionAnomalyState.NONE;
+
 		if (state == ExpansionAnomalyState.IDLE)
 		{
 		    //! Generate a random delay value between 0.0 and 2.0 seconds
@@ -413,7 +474,7 @@ class Expansion_Anomaly_Base: ItemBase
 		{
 			case ExpansionAnomalyState.IDLE:
 			{
-				if (m_PrevAnonmalyState == ExpansionAnomalyState.NOCORE)
+				if (transition && m_PrevAnonmalyState == ExpansionAnomalyState.NOCORE)
 				{
 					PlayParticle(m_ParticleActivated, GetAnomalyActivatedParticle());
 					SoundActivatedStart();
@@ -447,7 +508,7 @@ class Expansion_Anomaly_Base: ItemBase
 				//! Play activated VFX and sound when prevoius state was IDLE as that means the
 				//! anomaly core item status has changed when this case is called and we only want to trigger the activation VFX and sound here when that is the case.
 				//! We dont want to call the activated VFX when the player
-				if (m_PrevAnonmalyState != ExpansionAnomalyState.NOCORE)
+				if (transition && m_PrevAnonmalyState != ExpansionAnomalyState.NOCORE)
 				{
 					PlayParticle(m_ParticleActivated, GetAnomalyActivatedParticle());
 					SoundActivatedStart();
@@ -476,7 +537,7 @@ class Expansion_Anomaly_Base: ItemBase
 			break;
 			case ExpansionAnomalyState.UNSTABLE:
 			{
-				if (m_PrevAnonmalyState != ExpansionAnomalyState.UNSTABLE)
+				if (transition && m_PrevAnonmalyState != ExpansionAnomalyState.UNSTABLE)
 				{
 					PlayParticle(m_ParticleActivated, GetAnomalyActivatedParticle());
 					SoundActivatedStart();
@@ -494,7 +555,7 @@ class Expansion_Anomaly_Base: ItemBase
 			break;
 			case ExpansionAnomalyState.UNSTABLENOCORE:
 			{
-				if (m_PrevAnonmalyState != ExpansionAnomalyState.UNSTABLENOCORE)
+				if (transition && m_PrevAnonmalyState != ExpansionAnomalyState.UNSTABLENOCORE)
 				{
 					PlayParticle(m_ParticleActivated, GetAnomalyActivatedParticle());
 					SoundActivatedStart();
@@ -0,0 +1,143 @@
+/**
+ * ExpansionAnomalyVFXManager.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionAnomalyVFXManager
+ * @brief		Client side distance gating of anomaly particles, lights and sounds
+ *
+ * Anomalies only create their effects while the camera is within the activation radius, and drop them again
+ * once it is further away than activation radius + hysteresis, so walking along the edge doesn't toggle them.
+ * Activations and visual state changes of active anomalies are queued and applied at most ACTIVATIONS_PER_FRAME per frame,
+ * so an EVR storm switching every anomaly at once is spread over several frames.
+ **/
+class ExpansionAnomalyVFXManager
+{
+	static const int UPDATE_INTERVAL = 500;  //! ms between range checks
+	static const int ACTIVATIONS_PER_FRAME = 2;
+
+	//! Fixed, Namalsk adventure settings are server only
+	static const float ACTIVATION_RADIUS_SQ = 90000.0;  //! 300 m
+	static const float DEACTIVATION_RADIUS_SQ = 122500.0;  //! 300 m + 50 m hysteresis
+
+	protected static ref array<Expansion_Anomaly_Base> s_Queue = new array<Expansion_Anomaly_Base>;
+	protected static bool s_Running;
+	protected static bool s_Updating;
+
+	//! Called by anomalies on creation, runs until the last anomaly is gone
+	static void Start()
+	{
+		if (s_Running || !GetGame() || GetGame().IsDedicatedServer())
+			return;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(Tick, UPDATE_INTERVAL, true);
+		s_Running = true;
+	}
+
+	static void Stop()
+	{
+		if (s_Running)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(Tick);
+			s_Running = false;
+		}
+
+		if (s_Updating)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(Update);
+			s_Updating = false;
+		}
+
+		s_Queue.Clear();
+	}
+
+	static void Tick()
+	{
+		if (Expansion_Anomaly_Base.s_Expansion_AllAnomalies.m_Count == 0)
+		{
+			Stop();
+			return;
+		}
+
+		vector cameraPos = GetGame().GetCurrentCameraPosition();
+
+		auto node = Expansion_Anomaly_Base.s_Expansion_AllAnomalies.m_Head;
+		while (node)
+		{
+			Expansion_Anomaly_Base anomaly = node.m_Value;
+			node = node.m_Next;
+
+			if (!anomaly)
+				continue;
+
+			float distanceSq = vector.DistanceSq(cameraPos, anomaly.GetPosition());
+			if (anomaly.Expansion_IsVFXActive())
+			{
+				if (distanceSq > DEACTIVATION_RADIUS_SQ)
+					anomaly.Expansion_DeactivateVFX();
+			}
+			else if (distanceSq < ACTIVATION_RADIUS_SQ)
+			{
+				Enqueue(anomaly);
+			}
+		}
+	}
+
+	//! Queue activation or visual state update of an anomaly
+	static void Enqueue(Expansion_Anomaly_Base anomaly)
+	{
+		if (anomaly.m_Expansion_VFXQueued)
+			return;
+
+		anomaly.m_Expansion_VFXQueued = true;
+		s_Queue.Insert(anomaly);
+
+		if (!s_Updating)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Insert(Update);
+			s_Updating = true;
+		}
+	}
+
+	static void Update(float timeslice)
+	{
+		vector cameraPos = GetGame().GetCurrentCameraPosition();
+		int applied;
+
+		while (s_Queue.Count() > 0 && applied < ACTIVATIONS_PER_FRAME)
+		{
+			Expansion_Anomaly_Base anomaly = s_Queue[0];
+			s_Queue.RemoveOrdered(0);
+
+			if (!anomaly)
+				continue;
+
+			anomaly.m_Expansion_VFXQueued = false;
+
+			//! Camera may have moved away again while the anomaly was waiting
+			if (!anomaly.Expansion_IsVFXActive() && vector.DistanceSq(cameraPos, anomaly.GetPosition()) > DEACTIVATION_RADIUS_SQ)
+				continue;
+
+			anomaly.Expansion_ActivateVFX();
+			applied++;
+		}
+
+		if (s_Queue.Count() == 0)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(Update);
+			s_Updating = false;
+		}
+	}
+
+	static int GetQueueCount()
+	{
+		return s_Queue.Count();
+	}
+}
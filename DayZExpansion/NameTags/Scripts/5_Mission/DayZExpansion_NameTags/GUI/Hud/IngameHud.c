@@ -747,9 +747,11 @@ modded class IngameHud
 		if (!playerQuestData)
 			return false;
 
-		foreach (ExpansionQuestConfig questConfig: questConfigs)
+		array<int> questIDs = ExpansionQuestModule.GetModuleInstance().GetQuestConfigIndex().GetQuestIDsForNPC(questNPCID);
+		foreach (int questID: questIDs)
 		{
-			if (ExpansionQuestModule.GetModuleInstance().QuestDisplayConditions(questConfig, player, playerQuestData, questNPCID))
+			ExpansionQuestConfig questConfig = questConfigs[questID];
+			if (questConfig && ExpansionQuestModule.GetModuleInstance().QuestDisplayConditions(questConfig, player, playerQuestData, questNPCID))
 				return true;
 		}
 
@@ -46,6 +46,11 @@ class Expansion3DMarker: ScriptedWidgetEventHandler
 	private bool m_ShowPersonalDistance = true;
 	
 	private bool m_Show3DPartyMemberIcon = true;
+
+	//! Distance based refresh of text, icon and color. Screen position is still updated every frame while on screen.
+	private float m_RefreshTimer;
+	private string m_CurrentIcon;
+	private int m_IconColor;
 	
 	void Expansion3DMarker( ExpansionMarkerData data = NULL )
 	{
@@ -99,6 +104,15 @@ class Expansion3DMarker: ScriptedWidgetEventHandler
 	 * /return	boolean		False to remove the marker
 	 */
 	bool Update( float timeslice )
+	{
+		return Update( timeslice, GetGame().GetCurrentCameraPosition(), GetGame().GetCurrentCameraDirection() );
+	}
+
+	/**
+	 * /brief	Same as Update( timeslice ), but with camera position and direction supplied by the caller so they are only queried once per frame
+	 * /return	boolean		False to remove the marker
+	 */
+	bool Update( float timeslice, vector cameraPosition, vector cameraDirection )
 	{
 		if ( !m_LayoutRoot || !m_MarkerData )
 			return false;
@@ -128,11 +142,20 @@ class Expansion3DMarker: ScriptedWidgetEventHandler
 		}
 
 		vector position = m_MarkerData.GetAdjustedPosition();
+
+		//! Frustum culling - markers behind the camera don't need a screen projection
+		vector toMarker = position - cameraPosition;
+		if ( vector.Dot( toMarker, cameraDirection ) <= 0 )
+		{
+			Cull();
+			return true;
+		}
+
 		vector screen_position = GetGame().GetScreenPosRelative( position );
 		
 		if ( screen_position[0] >= 1 || screen_position[0] <= 0 || screen_position[1] >= 1 || screen_position[1] <= 0 || screen_position[2] <= 0 )
 		{
-			m_LayoutRoot.Show( false );
+			Cull();
 			return true;
 		}
 
@@ -141,6 +164,53 @@ class Expansion3DMarker: ScriptedWidgetEventHandler
 		float dist = vector.Distance( screen_position, Vector( 0.5, 0.5, screen_position[2] ) );
 		m_Transparency = ExpansionMath.LinearConversion( 0, 0.15, dist, m_TransparencyMin, m_TransparencyMax );
 		
+		float distance = toMarker.Length();
+
+		m_RefreshTimer -= timeslice;
+		if ( m_RefreshTimer <= 0 )
+		{
+			Refresh( distance );
+			m_RefreshTimer = GetRefreshInterval( distance );
+		}
+
+		m_Text_Name.SetColor( ARGB( m_Transparency, 255, 255, 255) );
+		m_Text_Distance.SetColor( ARGB( m_Transparency, 255, 255, 255) );
+		m_Image_Icon.SetColor( ARGB( m_Transparency, ( m_IconColor >> 16 ) & 0xFF, ( m_IconColor >> 8 ) & 0xFF, m_IconColor & 0xFF ) );
+		
+		m_LayoutRoot.Show( true );
+		m_LayoutRoot.SetPos( screen_position[0], screen_position[1] );
+
+		return true;
+	}
+
+	/**
+	 * /brief	Hide the marker while it is off screen and make sure it is refreshed as soon as it becomes visible again
+	 */
+	private void Cull()
+	{
+		m_LayoutRoot.Show( false );
+		m_RefreshTimer = 0;
+	}
+
+	/**
+	 * /brief	Markers far away from the camera barely change on screen, so their text, icon and size are refreshed less often
+	 */
+	static float GetRefreshInterval( float distance )
+	{
+		if ( distance < 250 )
+			return 0;
+
+		if ( distance < 1000 )
+			return 0.1;
+
+		if ( distance < 3000 )
+			return 0.25;
+
+		return 0.5;
+	}
+
+	private void Refresh( float distance )
+	{
 		if ( m_MarkerData.GetType() == ExpansionMapMarkerType.SERVER )
 		{
 			m_Text_Name.Show( m_ShowServerName );
@@ -166,35 +236,29 @@ class Expansion3DMarker: ScriptedWidgetEventHandler
 	#endif
 
 		m_Text_Name.SetText( m_MarkerData.GetName() );
-		m_Text_Name.SetColor( ARGB( m_Transparency, 255, 255, 255) );
 		
 		//! Set distance
-		float distance = vector.Distance( GetGame().GetCurrentCameraPosition(), position );
 		m_Text_Distance.SetText( Math.Ceil( distance ).ToString() + "m" );
-		m_Text_Distance.SetColor( ARGB( m_Transparency, 255, 255, 255) );
 
 		float scale = ExpansionMath.LinearConversion( 2000, 100, distance, 0.6, 1 );
 		m_Frame.SetSize( m_OriginalWidth * scale, m_OriginalHeight * scale );
-		
-		m_LayoutRoot.Show( true );
-		m_LayoutRoot.SetPos( screen_position[0], screen_position[1] );
-
-		m_Image_Icon.LoadImageFile( 0, m_MarkerData.GetIcon() );
-		m_Image_Icon.SetImage( 0 );
 
-		int markerColorA = 0;
-		int markerColorR = 0;
-		int markerColorG = 0;
-		int markerColorB = 0;
-		ExpansionStatic.IntToARGB( m_MarkerData.GetColor(), markerColorA, markerColorR, markerColorG, markerColorB );
-		m_Image_Icon.SetColor( ARGB( m_Transparency, markerColorR, markerColorG, markerColorB ) );
+		//! Only reload the image when the icon actually changed
+		string icon = m_MarkerData.GetIcon();
+		if ( icon != m_CurrentIcon )
+		{
+			m_Image_Icon.LoadImageFile( 0, icon );
+			m_Image_Icon.SetImage( 0 );
+			m_CurrentIcon = icon;
+		}
 
-		return true;
+		m_IconColor = m_MarkerData.GetColor();
 	}
 
 	void SetMarkerData( ExpansionMarkerData data )
 	{
 		m_MarkerData = data;
+		m_RefreshTimer = 0;
 		
 		RefreshAlphaMinColor();
 
@@ -229,6 +293,9 @@ class Expansion3DMarker: ScriptedWidgetEventHandler
 		m_LayoutRoot = GetGame().GetWorkspace().CreateWidgets( m_LayoutPath );
 		
 		OnWidgetScriptInit( m_LayoutRoot );
+
+		m_CurrentIcon = string.Empty;
+		m_RefreshTimer = 0;
 	}
 
 	// ------------------------------------------------------------
@@ -539,9 +539,12 @@ class ExpansionMarkerModule: CF_ModuleWorld
 			m_TimeAccumulator = 0;
 		}
 
+		vector cameraPosition = GetGame().GetCurrentCameraPosition();
+		vector cameraDirection = GetGame().GetCurrentCameraDirection();
+
 		for ( int i = m_3DMarkers.Count() - 1; i >= 0; i-- )
 		{
-			if ( !m_3DMarkers[i] || !m_3DMarkers[i].Update( update.DeltaTime ) )
+			if ( !m_3DMarkers[i] || !m_3DMarkers[i].Update( update.DeltaTime, cameraPosition, cameraDirection ) )
 			{
 				Expansion3DMarker marker = m_3DMarkers[i];
 				m_3DMarkers.Remove(i);
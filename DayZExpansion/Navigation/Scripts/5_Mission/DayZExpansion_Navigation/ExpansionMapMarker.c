@@ -205,6 +205,66 @@ class ExpansionMapMarker : ExpansionMapWidgetBase
 		}
 	}
 
+	override bool CanCull()
+	{
+		if (!m_Data || ShouldHide())
+			return false;
+
+		return !IsCreating() && !IsEditting() && !IsDragging() && !m_MouseHover;
+	}
+
+	//! Only server markers are merged, the player's own personal and party markers always stay visible and selectable
+	override bool CanCluster()
+	{
+		return m_Data && m_Data.GetType() == ExpansionMapMarkerType.SERVER;
+	}
+
+	override vector GetCullPosition()
+	{
+		return m_Data.GetPosition();
+	}
+
+	/**
+	 * @brief Reset this marker so the map menu can keep its widgets around for reuse
+	 */
+	void ResetForPool()
+	{
+		if (IsEditting())
+			CloseEditPanel();
+
+		if (m_Data && m_Data.GetHandler() == this)
+			m_Data.SetHandler(NULL);
+
+		m_Data = NULL;
+		m_MapMenu = NULL;
+		m_Creating = false;
+		m_Dragging = false;
+		m_MouseHover = false;
+		m_Culled = false;
+
+		delete m_PositionToolTip;
+
+		Hide();
+
+		SetParentWidget(NULL, NULL);
+	}
+
+	//! Move the marker widgets to another layout, pooled markers are detached until a map menu reuses them
+	void SetParentWidget(Widget parent, MapWidget mapWidget)
+	{
+		Widget current = m_LayoutRoot.GetParent();
+		if (current != parent)
+		{
+			if (current)
+				current.RemoveChild(m_LayoutRoot);
+
+			if (parent)
+				parent.AddChild(m_LayoutRoot);
+		}
+
+		m_MapWidget = mapWidget;
+	}
+
 	bool ShouldHide()
 	{
 		if (!m_Data.IsMapVisible())
@@ -43,4 +43,13 @@ class ExpansionMapMarkerPlayer : ExpansionMapMarker
 	{
 		return false;
 	}
+
+	// ------------------------------------------------------------
+	// ExpansionMapMarker CanCluster
+	// ------------------------------------------------------------	
+	//! Party members should always be visible on their own
+	override bool CanCluster()
+	{
+		return false;
+	}
 };
\ No newline at end of file
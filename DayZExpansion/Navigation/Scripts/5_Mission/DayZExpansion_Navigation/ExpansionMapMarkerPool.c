@@ -0,0 +1,95 @@
+/**
+ * ExpansionMapMarkerPool.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionMapMarkerPool
+ * @brief		Keeps released map marker widgets around so the map menu doesn't have to create and destroy them when markers come and go
+ *
+ * Owned by the mission (MissionBase::Expansion_GetMapMarkerPool), so markers survive closing and reopening the map.
+ * Released markers are detached from the menu layout and attached to the layout of the menu that acquires them next.
+ **/
+class ExpansionMapMarkerPool
+{
+	static const int MAX_POOLED_PER_TYPE = 128;
+
+	protected ref map<typename, ref array<ref ExpansionMapMarker>> m_Free;
+
+	void ExpansionMapMarkerPool()
+	{
+		m_Free = new map<typename, ref array<ref ExpansionMapMarker>>;
+	}
+
+	/**
+	 * @brief Get a previously released marker of the exact given type
+	 * @return Pooled marker or NULL if there is none, in which case the caller has to create a new one
+	 */
+	ExpansionMapMarker Acquire(typename type, Widget parent, MapWidget mapWidget)
+	{
+		array<ref ExpansionMapMarker> free = m_Free.Get(type);
+		if (!free || free.Count() == 0)
+			return NULL;
+
+		int last = free.Count() - 1;
+		ExpansionMapMarker marker = free[last];
+		free.Remove(last);
+
+		marker.SetParentWidget(parent, mapWidget);
+
+		return marker;
+	}
+
+	//! Only plain, server and party member markers are acquired from the pool
+	static bool IsPoolable(ExpansionMapMarker marker)
+	{
+		typename type = marker.Type();
+		return type == ExpansionMapMarker || type == ExpansionMapMarkerServer || type == ExpansionMapMarkerPlayer;
+	}
+
+	void Release(ExpansionMapMarker marker)
+	{
+		if (!marker)
+			return;
+
+		marker.ResetForPool();
+
+		typename type = marker.Type();
+		array<ref ExpansionMapMarker> free = m_Free.Get(type);
+		if (!free)
+		{
+			free = new array<ref ExpansionMapMarker>;
+			m_Free.Insert(type, free);
+		}
+
+		if (free.Count() >= MAX_POOLED_PER_TYPE)
+		{
+			delete marker;
+			return;
+		}
+
+		free.Insert(marker);
+	}
+
+	int Count()
+	{
+		int count;
+		foreach (typename type, array<ref ExpansionMapMarker> free: m_Free)
+		{
+			count += free.Count();
+		}
+
+		return count;
+	}
+
+	void Clear()
+	{
+		m_Free.Clear();
+	}
+};
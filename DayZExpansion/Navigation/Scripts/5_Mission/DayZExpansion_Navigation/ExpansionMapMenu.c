@@ -43,6 +43,12 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 	protected bool m_DoUpdateMarkers;
 	protected int m_MaxMarkerUpdatesPerFrame = 3;  //! Max markers updated per frame for each marker type
 
+	protected ExpansionMapMarkerPool m_MarkerPool;  //! Owned by the mission so marker widgets outlive this menu
+	protected ref set<int> m_ClusterCells;
+	protected const float CULL_MARGIN = 64;  //! Screen pixels outside of the map widget before a marker is culled
+	protected const float CLUSTER_CELL_SIZE = 24;  //! Server markers within the same screen cell are merged when zoomed out, the first one in m_Markers stays visible
+	protected const float CLUSTER_MIN_SCALE = 0.5;  //! Map scale from which on markers get clustered
+
 	protected ref array<string> m_PartyMarkersCheckArr;
 	protected int m_PartyMarkersUpdateIndex;
 	protected bool m_PartyMarkersUpdated;
@@ -110,6 +116,8 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 	#endif
 
 		m_DeletingMarkers = new set<ExpansionMapMarker>();
+		m_MarkerPool = MissionBase.Cast(GetGame().GetMission()).Expansion_GetMapMarkerPool();
+		m_ClusterCells = new set<int>();
 		Class.CastTo(m_PlayerB, GetGame().GetPlayer());
 		CF_Modules<ExpansionMarkerModule>.Get(m_MarkerModule);
 
@@ -131,6 +139,17 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 		EXLogPrint("ExpansionMapMenu::~ExpansionMapMenu - Start");
 		#endif
 
+		//! Hand all poolable markers back before the layout they are parented to goes away
+		for (int i = m_Markers.Count() - 1; i >= 0; i--)
+		{
+			ExpansionMapMarker marker = ExpansionMapMarker.Cast(m_Markers[i]);
+			if (marker && ExpansionMapMarkerPool.IsPoolable(marker))
+			{
+				ReleaseMarker(marker);
+				m_Markers.Remove(i);
+			}
+		}
+
 		delete m_Markers;
 		delete m_PersonalMarkers;
 		delete m_ServerMarkers;
@@ -400,12 +419,12 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 			{
 				if (marker.GetMarkerData().GetType() == ExpansionMapMarkerType.PERSONAL)
 				{
+					ReleaseMarker(marker);
+
 					int idx2 = m_Markers.Find(marker);
 					if (idx2 != -1)
 						m_Markers.Remove(idx2);
 
-					delete marker;
-					m_DeletingMarkers.Remove(i);
 					i--;
 				}
 			}
@@ -425,8 +444,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 			marker = m_PersonalMarkers.Get(uid);
 			if (!marker)
 			{
-				marker = new ExpansionMapMarker(layoutRoot, m_MapWidget, false);
-				marker.Init();
+				marker = AcquireMarker(ExpansionMapMarker);
 				m_PersonalMarkers.Insert(uid, marker);
 				m_Markers.Insert(marker);
 			}
@@ -460,7 +478,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 
 					m_PersonalMarkers.Remove(m_PersonalMarkersCheckArr[index]);
 					m_MarkerList.RemovePersonalEntry(marker);
-					delete marker;
+					ReleaseMarker(marker);
 				}
 			}
 
@@ -499,7 +517,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 
 					m_PartyMarkers.Set(uuid, NULL);
 					m_MarkerList.RemovePartyEntry(mmarker);
-					delete mmarker;
+					ReleaseMarker(mmarker);
 				}
 			}
 
@@ -525,12 +543,12 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 			{
 				if (marker.GetMarkerData().GetType() == ExpansionMapMarkerType.PARTY)
 				{
+					ReleaseMarker(marker);
+
 					int idx2 = m_Markers.Find(marker);
 					if (idx2 != -1)
 						m_Markers.Remove(idx2);
 
-					delete marker;
-					m_DeletingMarkers.Remove(i);
 					i--;
 				}
 			}
@@ -549,8 +567,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 			marker = m_PartyMarkers.Get(uid);
 			if (!marker)
 			{
-				marker = new ExpansionMapMarker(layoutRoot, m_MapWidget, false);
-				marker.Init();
+				marker = AcquireMarker(ExpansionMapMarker);
 				m_PartyMarkers.Insert(uid, marker);
 				m_Markers.Insert(marker);
 			}
@@ -583,7 +600,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 
 					m_PartyMarkers.Remove(m_PartyMarkersCheckArr[index]);
 					m_MarkerList.RemovePartyEntry(marker);
-					delete marker;
+					ReleaseMarker(marker);
 				}
 			}
 
@@ -636,8 +653,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 			marker = m_ServerMarkers.Get(uid);
 			if (!marker)
 			{
-				marker = new ExpansionMapMarkerServer(layoutRoot, m_MapWidget, false);
-				marker.Init();
+				marker = AcquireMarker(ExpansionMapMarkerServer);
 				m_ServerMarkers.Insert(uid, marker);
 				m_Markers.Insert(marker);
 			}
@@ -668,7 +684,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 
 					m_ServerMarkers.Remove(m_ServerMarkersCheckArr[index]);
 					m_MarkerList.RemoveServerEntry(marker);
-					delete marker;
+					ReleaseMarker(marker);
 				}
 			}
 
@@ -707,7 +723,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 
 					m_PlayerMarkers.Set(uuid, NULL);
 					m_MarkerList.RemoveMemberEntry(mmarker);
-					delete mmarker;
+					ReleaseMarker(mmarker);
 				}
 			}
 
@@ -747,8 +763,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 			marker = ExpansionMapMarkerPlayer.Cast(m_PlayerMarkers.Get(uid));
 			if (!marker)
 			{
-				marker = new ExpansionMapMarkerPlayer(layoutRoot, m_MapWidget, false);
-				marker.Init();
+				marker = ExpansionMapMarkerPlayer.Cast(AcquireMarker(ExpansionMapMarkerPlayer));
 				m_PlayerMarkers.Insert(uid, marker);
 				m_Markers.Insert(marker);
 			}
@@ -782,7 +797,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 
 					m_PlayerMarkers.Remove(m_PlayerMarkersCheckArr[index]);
 					m_MarkerList.RemoveMemberEntry(marker);
-					delete marker;
+					ReleaseMarker(marker);
 				}
 			}
 
@@ -795,6 +810,100 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 	}
 #endif
 
+	// ------------------------------------------------------------
+	// Expansion AcquireMarker
+	// ------------------------------------------------------------
+	//! Reuse a pooled marker widget of the given type if there is one, otherwise create a new one
+	protected ExpansionMapMarker AcquireMarker(typename type)
+	{
+		ExpansionMapMarker marker = m_MarkerPool.Acquire(type, layoutRoot, m_MapWidget);
+		if (marker)
+			return marker;
+
+		if (type == ExpansionMapMarkerServer)
+			marker = new ExpansionMapMarkerServer(layoutRoot, m_MapWidget, false);
+		else if (type == ExpansionMapMarkerPlayer)
+			marker = new ExpansionMapMarkerPlayer(layoutRoot, m_MapWidget, false);
+		else
+			marker = new ExpansionMapMarker(layoutRoot, m_MapWidget, false);
+
+		marker.Init();
+
+		return marker;
+	}
+
+	// ------------------------------------------------------------
+	// Expansion ReleaseMarker
+	// ------------------------------------------------------------
+	//! Hand a marker that is no longer needed back to the pool. Caller is responsible for removing it from m_Markers and the marker list.
+	protected void ReleaseMarker(ExpansionMapMarker marker)
+	{
+		int index = m_DeletingMarkers.Find(marker);
+		if (index != -1)
+			m_DeletingMarkers.Remove(index);
+
+		if (m_SelectedMarker == marker)
+			m_SelectedMarker = NULL;
+
+		m_MarkerPool.Release(marker);
+	}
+
+	// ------------------------------------------------------------
+	// Expansion UpdateMarkerWidgets
+	// ------------------------------------------------------------
+	//! Update marker widgets, skipping those outside of the visible map area and merging crowded ones when zoomed out
+	protected void UpdateMarkerWidgets(float timeslice)
+	{
+		float mapX, mapY, mapW, mapH;
+		m_MapWidget.GetScreenPos(mapX, mapY);
+		m_MapWidget.GetScreenSize(mapW, mapH);
+
+		//! Visible area (plus margin) in map coordinates, so markers outside of it are culled without converting their position to screen space
+		vector topLeft = m_MapWidget.ScreenToMap(Vector(mapX - CULL_MARGIN, mapY - CULL_MARGIN, 0));
+		vector bottomRight = m_MapWidget.ScreenToMap(Vector(mapX + mapW + CULL_MARGIN, mapY + mapH + CULL_MARGIN, 0));
+
+		float minX = Math.Min(topLeft[0], bottomRight[0]);
+		float maxX = Math.Max(topLeft[0], bottomRight[0]);
+		float minZ = Math.Min(topLeft[2], bottomRight[2]);
+		float maxZ = Math.Max(topLeft[2], bottomRight[2]);
+
+		bool cluster = m_MapWidget.GetScale() >= CLUSTER_MIN_SCALE;
+		m_ClusterCells.Clear();
+
+		for (int i = 0; i < m_Markers.Count(); ++i)
+		{
+			ExpansionMapWidgetBase marker = m_Markers[i];
+			if (!marker)
+				continue;
+
+			if (marker.CanCull() && marker != m_SelectedMarker)
+			{
+				vector mapPos = marker.GetCullPosition();
+				if (mapPos[0] < minX || mapPos[0] > maxX || mapPos[2] < minZ || mapPos[2] > maxZ)
+				{
+					marker.SetCulled(true);
+					continue;
+				}
+
+				if (cluster && marker.CanCluster())
+				{
+					vector screenPos = m_MapWidget.MapToScreen(mapPos);
+					int cell = Math.Floor(screenPos[0] / CLUSTER_CELL_SIZE) * 4096 + Math.Floor(screenPos[1] / CLUSTER_CELL_SIZE);
+					if (m_ClusterCells.Find(cell) != -1)
+					{
+						marker.SetCulled(true);
+						continue;
+					}
+
+					m_ClusterCells.Insert(cell);
+				}
+			}
+
+			marker.SetCulled(false);
+			marker.Update(timeslice);
+		}
+	}
+
 	// ------------------------------------------------------------
 	// Expansion CreateNewMarker
 	// ------------------------------------------------------------
@@ -1347,15 +1456,7 @@ class ExpansionMapMenu: ExpansionUIScriptedMenu
 		UpdateMapPosition();
 
 		if (layoutRoot.IsVisible())
-		{
-			for (int i = 0; i < m_Markers.Count(); ++i)
-			{
-				if (m_Markers[i])
-				{
-					m_Markers[i].Update(timeslice);
-				}
-			}
-		}
+			UpdateMarkerWidgets(timeslice);
 
 		if (m_DoUpdateMarkers)
 		{
@@ -12,6 +12,16 @@
 
 modded class MissionBase
 {
+	protected ref ExpansionMapMarkerPool m_Expansion_MapMarkerPool;
+
+	ExpansionMapMarkerPool Expansion_GetMapMarkerPool()
+	{
+		if (!m_Expansion_MapMarkerPool)
+			m_Expansion_MapMarkerPool = new ExpansionMapMarkerPool();
+
+		return m_Expansion_MapMarkerPool;
+	}
+
 	override UIScriptedMenu CreateScriptedMenu(int id)
 	{
 		UIScriptedMenu menu = NULL;
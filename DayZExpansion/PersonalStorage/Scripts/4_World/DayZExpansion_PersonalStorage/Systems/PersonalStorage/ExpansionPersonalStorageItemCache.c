@@ -0,0 +1,194 @@
+/**
+ * ExpansionPersonalStorageItemCache.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+//! Stored items of one player with item counts per storage ID
+class ExpansionPersonalStoragePlayerItems
+{
+	string m_PlayerUID;
+	ref array<ref ExpansionPersonalStorageItem> m_Items;
+	protected ref map<int, int> m_CountByStorageID;
+
+	void ExpansionPersonalStoragePlayerItems(string playerUID)
+	{
+		m_PlayerUID = playerUID;
+		m_Items = new array<ref ExpansionPersonalStorageItem>;
+		m_CountByStorageID = new map<int, int>;
+	}
+
+	void Add(ExpansionPersonalStorageItem item)
+	{
+		m_Items.Insert(item);
+
+		int storageID = item.GetStorageID();
+		m_CountByStorageID.Set(storageID, m_CountByStorageID[storageID] + 1);
+	}
+
+	void RemoveAt(int index)
+	{
+		int storageID = m_Items[index].GetStorageID();
+		int count = m_CountByStorageID[storageID] - 1;
+		if (count > 0)
+			m_CountByStorageID.Set(storageID, count);
+		else
+			m_CountByStorageID.Remove(storageID);
+
+		m_Items.RemoveOrdered(index);
+	}
+
+	//! @param isGlobal Count items in all storages
+	int GetCount(int storageID = -1, bool isGlobal = false)
+	{
+		if (isGlobal)
+			return m_Items.Count();
+
+		return m_CountByStorageID[storageID];
+	}
+
+	ExpansionPersonalStorageItem FindByGlobalID(TIntArray globalID)
+	{
+		foreach (ExpansionPersonalStorageItem item: m_Items)
+		{
+			if (item && item.IsGlobalIDValid() && item.IsGlobalIDEqual(globalID))
+				return item;
+		}
+
+		return null;
+	}
+}
+
+/**@class		ExpansionPersonalStorageItemCache
+ * @brief		Server side cache of personal storage item data.
+ *
+ * Item data of a player is loaded from the player's storage directory on first access (connect or storage menu open)
+ * instead of loading every player who ever used personal storage on mission start.
+ * Data of disconnected players stays in memory until it is the least recently used of more than MAX_OFFLINE_PLAYERS.
+ * Item files are written immediately when items are stored/retrieved, so evicted data never needs to be saved.
+ **/
+class ExpansionPersonalStorageItemCache
+{
+	static const int MAX_OFFLINE_PLAYERS = 64;
+
+	protected ref map<string, ref ExpansionPersonalStoragePlayerItems> m_Players;
+	protected ref set<string> m_Online;
+	protected ref array<string> m_OfflineLRU;
+
+	void ExpansionPersonalStorageItemCache()
+	{
+		m_Players = new map<string, ref ExpansionPersonalStoragePlayerItems>;
+		m_Online = new set<string>;
+		m_OfflineLRU = new array<string>;
+	}
+
+	//! Get item data of player with the given UID, loading it from disk if it isn't in memory yet
+	ExpansionPersonalStoragePlayerItems Get(string playerUID)
+	{
+		ExpansionPersonalStoragePlayerItems playerItems = m_Players[playerUID];
+		if (!playerItems)
+		{
+			playerItems = Load(playerUID);
+			m_Players.Insert(playerUID, playerItems);
+		}
+
+		Touch(playerUID);
+
+		return playerItems;
+	}
+
+	//! @return Item data of the given player if already loaded, without loading it
+	ExpansionPersonalStoragePlayerItems GetLoaded(string playerUID)
+	{
+		return m_Players[playerUID];
+	}
+
+	void OnConnect(string playerUID)
+	{
+		m_Online.Insert(playerUID);
+
+		int index = m_OfflineLRU.Find(playerUID);
+		if (index > -1)
+			m_OfflineLRU.RemoveOrdered(index);
+
+		Get(playerUID);
+	}
+
+	void OnDisconnect(string playerUID)
+	{
+		int index = m_Online.Find(playerUID);
+		if (index > -1)
+			m_Online.Remove(index);
+
+		if (m_Players.Contains(playerUID))
+			Touch(playerUID);
+	}
+
+	void Clear()
+	{
+		m_Players.Clear();
+		m_Online.Clear();
+		m_OfflineLRU.Clear();
+	}
+
+	int Count()
+	{
+		return m_Players.Count();
+	}
+
+	protected void Touch(string playerUID)
+	{
+		if (m_Online.Find(playerUID) > -1)
+			return;
+
+		int index = m_OfflineLRU.Find(playerUID);
+		if (index > -1)
+			m_OfflineLRU.RemoveOrdered(index);
+
+		m_OfflineLRU.Insert(playerUID);
+
+		while (m_OfflineLRU.Count() > MAX_OFFLINE_PLAYERS)
+		{
+			m_Players.Remove(m_OfflineLRU[0]);
+			m_OfflineLRU.RemoveOrdered(0);
+		}
+	}
+
+	protected ExpansionPersonalStoragePlayerItems Load(string playerUID)
+	{
+		auto trace = EXTrace.Start(EXTrace.PERSONALSTORAGE, this, playerUID);
+
+		ExpansionPersonalStoragePlayerItems playerItems = new ExpansionPersonalStoragePlayerItems(playerUID);
+
+		string storagePath = ExpansionPersonalStorageModule.GetPersonalStorageDataDirectory() + playerUID + "\\";
+		if (!FileExist(storagePath))
+			return playerItems;
+
+		array<string> personalStorageFiles = ExpansionStatic.FindFilesInLocation(storagePath, ".json");
+		foreach (string fileName: personalStorageFiles)
+		{
+			ExpansionPersonalStorageItem itemData = ExpansionPersonalStorageItem.Load(storagePath + fileName);
+			if (!itemData)
+				continue;
+
+			//! Check if the entity storage file still exists otherwise we delete the personal storage item file and dont add it to the system.
+			if (!FileExist(itemData.GetEntityStorageFileName()))
+			{
+				DeleteFile(storagePath + fileName); //! Delete the personal storage item JSON file.
+				continue;
+			}
+
+			playerItems.Add(itemData);
+		}
+
+		EXTrace.Add(trace, "Items: " + playerItems.m_Items.Count());
+
+		return playerItems;
+	}
+}
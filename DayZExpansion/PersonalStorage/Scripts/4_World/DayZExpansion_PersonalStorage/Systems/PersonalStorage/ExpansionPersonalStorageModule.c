@@ -59,7 +59,7 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 	protected static ExpansionPersonalStorageModule s_Instance;
 	static string s_PersonalStorageConfigFolderPath = "$mission:expansion\\personalstorage\\";
 
-	protected ref map<string, ref array<ref ExpansionPersonalStorageItem>> m_ItemsData; //! Server
+	protected ref ExpansionPersonalStorageItemCache m_ItemCache; //! Server
 	protected ref map<int, ref ExpansionPersonalStorageConfig> m_PersonalStorageConfig; //! Server
 
 	protected ref ExpansionPersonalStoragePlayerInventory m_LocalEntityInventory; //! Client
@@ -118,27 +118,14 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 	{
 		if (GetGame().IsServer() && GetGame().IsMultiplayer())
 		{
-			m_ItemsData = new map<string, ref array<ref ExpansionPersonalStorageItem>>;
+			//! Item data is loaded per player on connect or first access, see ExpansionPersonalStorageItemCache
+			m_ItemCache = new ExpansionPersonalStorageItemCache();
 			m_PersonalStorageConfig = new map<int, ref ExpansionPersonalStorageConfig>;
 			if (GetExpansionSettings().GetPersonalStorage().Enabled)
 			{
 				CreateDirectoryStructure();
 				LoadPersonalStorageServerConfig();
 			}
-			
-			array<string> personalStorageDirs = ExpansionStatic.FindDirectoriesInLocation(GetPersonalStorageDataDirectory());
-			foreach (string directoryName: personalStorageDirs)
-			{
-				if (!m_ItemsData.Contains(directoryName))
-				{
-					EXTrace.Start(EXTrace.PERSONALSTORAGE, this, "::OnMissionStart - Add personal storage data for player with UID: " + directoryName);
-					LoadPersonalStorageItemData(directoryName);
-				}
-				else
-				{
-					EXTrace.Start(EXTrace.PERSONALSTORAGE, this, "::OnMissionStart - Personal storage data for player with UID: " + directoryName + " already loaded! Skip..");
-				}
-			}
 		}
 
 		m_Initialized = true;
@@ -225,52 +212,32 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 		personalStorageConfig.Spawn(); //! Spawn the personal storage.
 	}
 
-	protected void LoadPersonalStorageItemData(string directoyName)
+#ifdef SERVER
+	override void OnInvokeConnect(Class sender, CF_EventArgs args)
 	{
 		auto trace = EXTrace.Start(EXTrace.PERSONALSTORAGE, this);
-		
-		string storagePath = ExpansionPersonalStorageModule.GetPersonalStorageDataDirectory() + directoyName + "\\";
-		if (FileExist(storagePath))
-		{
-			array<string> personalStorageFiles = ExpansionStatic.FindFilesInLocation(storagePath, ".json");
-			foreach (string fileName: personalStorageFiles)
-			{
-				GetPersonalStorageItemData(fileName, storagePath);
-			}
-		}
+
+		super.OnInvokeConnect(sender, args);
+
+		auto cArgs = CF_EventPlayerArgs.Cast(args);
+
+		if (m_ItemCache && cArgs.Identity)
+			m_ItemCache.OnConnect(cArgs.Identity.GetId());
 	}
 
-	protected void GetPersonalStorageItemData(string fileName, string path)
+	override void OnClientDisconnect(Class sender, CF_EventArgs args)
 	{
 		auto trace = EXTrace.Start(EXTrace.PERSONALSTORAGE, this);
-		
-		ExpansionPersonalStorageItem itemData = ExpansionPersonalStorageItem.Load(path + fileName);
-		if (!itemData)
-			return;
 
-		//! Check if the entity storage file still exists otherwise we delete the personal storage item file and dont add it to the system.
-		if (!FileExist(itemData.GetEntityStorageFileName()))
-		{
-			DeleteFile(path + fileName); //! Delete the personal storage item JSON file.
-			itemData = null;
-			return;
-		}
+		super.OnClientDisconnect(sender, args);
 
-		string playerUID = itemData.GetOwnerUID();
-		array<ref ExpansionPersonalStorageItem> items;
-		if (m_ItemsData.Find(playerUID, items))
-		{
-			items.Insert(itemData);
-			m_ItemsData.Set(playerUID, items);
-		}
-		else
-		{
-			items = new array<ref ExpansionPersonalStorageItem>;
-			items.Insert(itemData);
-			m_ItemsData.Insert(playerUID, items);
-		}
+		auto cArgs = CF_EventPlayerDisconnectedArgs.Cast(args);
+
+		if (m_ItemCache)
+			m_ItemCache.OnDisconnect(cArgs.UID);
 	}
-	
+#endif
+
 	//! Server
 	void SendItemData(PlayerIdentity identity, int storageID = -1, string displayName = string.Empty, string displayIcon = string.Empty, ExpansionPersonalStorageModuleCallback callback = 0)
 	{
@@ -290,19 +257,13 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 		rpc.Write(displayName);
 		rpc.Write(displayIcon);
 
-		array<ref ExpansionPersonalStorageItem> items = m_ItemsData[playerUID];
+		array<ref ExpansionPersonalStorageItem> items = m_ItemCache.Get(playerUID).m_Items;
 		array<ExpansionPersonalStorageItem> itemsToSend = new array<ExpansionPersonalStorageItem>;
 
-		if (items && items.Count() > 0)
+		foreach (ExpansionPersonalStorageItem item: items)
 		{
-			foreach (ExpansionPersonalStorageItem item: items)
-			{
-				if (storageConfig.IsGlobalStorage() || item.GetStorageID() == storageID)
-				{
-					if (itemsToSend.Find(item) == -1)
-						itemsToSend.Insert(item);
-				}
-			}
+			if (storageConfig.IsGlobalStorage() || item.GetStorageID() == storageID)
+				itemsToSend.Insert(item);
 		}
 
 		rpc.Write(itemsToSend.Count());
@@ -563,23 +524,20 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 	void RestorePersonalStorageCase(PlayerBase player)
 	{
 		string playerUID = player.GetIdentity().GetId();
-		array<ref ExpansionPersonalStorageItem> items;
-		if (m_ItemsData.Find(playerUID, items))
+		array<ref ExpansionPersonalStorageItem> items = m_ItemCache.Get(playerUID).m_Items;
+		foreach (ExpansionPersonalStorageItem item: items)
 		{
-			foreach (ExpansionPersonalStorageItem item: items)
+			typename itemType = item.GetClassName().ToType();
+			if (itemType && itemType.IsInherited(ExpansionPersonalProtectiveCaseBase))
 			{
-				typename itemType = item.GetClassName().ToType();
-				if (itemType && itemType.IsInherited(ExpansionPersonalProtectiveCaseBase))
+				EntityAI loadedEntity;
+				if (!LoadItem(item, player, loadedEntity))
 				{
-					EntityAI loadedEntity;
-					if (!LoadItem(item, player, loadedEntity))
-					{
-						Error(ToString() + "::RestorePersonalStorageCase - Could not restore stored personal storage case with global ID: " + item.GetGlobalID());
-						return;
-					}
-
+					Error(ToString() + "::RestorePersonalStorageCase - Could not restore stored personal storage case with global ID: " + item.GetGlobalID());
 					return;
 				}
+
+				return;
 			}
 		}
 	}
@@ -661,18 +619,7 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 
 	void AddStoredItem(string playerUID, ExpansionPersonalStorageItem item)
 	{
-		array<ref ExpansionPersonalStorageItem> currentItems;
-		if (m_ItemsData.Find(playerUID, currentItems))
-		{
-			currentItems.Insert(item);
-			m_ItemsData.Set(playerUID, currentItems);
-		}
-		else
-		{
-			currentItems = new array<ref ExpansionPersonalStorageItem>;
-			currentItems.Insert(item);
-			m_ItemsData.Insert(playerUID, currentItems);
-		}
+		m_ItemCache.Get(playerUID).Add(item);
 	}
 
 	array<EntityAI> GetSlotItems(EntityAI entity, inout bool hasEngineBeltSlot)
@@ -695,25 +642,7 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 
 	protected int GetPlayerItemsCount(string playerUID, int storageID = -1, bool isGlobal = false)
 	{
-		int count;
-		foreach (string uid, array<ref ExpansionPersonalStorageItem> items: m_ItemsData)
-		{
-			if (uid != playerUID)
-				continue;
-
-			foreach (ExpansionPersonalStorageItem item: items)
-			{
-				if (item.GetOwnerUID() == playerUID)
-				{
-					if (!isGlobal && item.GetStorageID() != storageID)
-						continue;
-
-					count++;
-				}
-			}
-		}
-
-		return count;
+		return m_ItemCache.Get(playerUID).GetCount(storageID, isGlobal);
 	}
 
 	protected bool StoreItem(ExpansionPersonalStorageItem item, EntityAI itemEntity)
@@ -753,22 +682,18 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 
 	protected void RemoveItemByGlobalID(string playerUID, TIntArray globalID)
 	{
-		array<ref ExpansionPersonalStorageItem> items;
-		if (!m_ItemsData.Find(playerUID, items))
-			return;
-
+		ExpansionPersonalStoragePlayerItems playerItems = m_ItemCache.Get(playerUID);
+		array<ref ExpansionPersonalStorageItem> items = playerItems.m_Items;
 		for (int i = items.Count() - 1; i >= 0; i--)
 		{
 			ExpansionPersonalStorageItem item = items[i];
 			if (item.IsGlobalIDValid() && item.IsGlobalIDEqual(globalID))
 			{
 				DeleteFile(item.GetEntityStorageFileName());
-				items.RemoveOrdered(i);
+				playerItems.RemoveAt(i);
 			}
 		}
 
-		m_ItemsData.Insert(playerUID, items);
-
 		string fileName = ExpansionStatic.IntToHex(globalID);
 		string filePath = GetPersonalStorageDataDirectory() + playerUID + "\\" + fileName + ".json";
 		if (FileExist(filePath))
@@ -777,20 +702,7 @@ class ExpansionPersonalStorageModule: CF_ModuleWorld
 
 	protected ExpansionPersonalStorageItem GetPersonalItemByGlobalID(string playerUID, TIntArray globalID)
 	{
-		array<ref ExpansionPersonalStorageItem> items;
-		if (m_ItemsData.Find(playerUID, items))
-		{
-			for (int i = 0; i < items.Count(); i++)
-			{
-				ExpansionPersonalStorageItem item = items[i];
-				if (item && item.IsGlobalIDValid() && item.IsGlobalIDEqual(globalID))
-				{
-					return item;
-				}
-			}
-		}
-
-		return null;
+		return m_ItemCache.Get(playerUID).FindByGlobalID(globalID);
 	}
 
 	static bool ItemCheckEx(EntityAI item)
@@ -0,0 +1,142 @@
+/**
+ * ExpansionQuestConfigIndex.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+/**@class		ExpansionQuestConfigIndex
+ * @brief		Lookup tables built once from the loaded quest configs (server) or received quest configs (client).
+ *
+ * Maps quest NPC IDs to the quests that can possibly be displayed on that NPC, so NPC interactions and markers
+ * don't have to run ExpansionQuestModule::QuestDisplayConditions on every quest config,
+ * and quest IDs to the quests whose display conditions depend on them (pre-quest and follow-up relations).
+ **/
+class ExpansionQuestConfigIndex
+{
+	protected ref map<int, ref array<int>> m_QuestIDsByNPC;
+	protected ref array<int> m_UnboundQuestIDs;
+	protected ref map<int, ref array<int>> m_DependentQuestIDs;
+
+	void ExpansionQuestConfigIndex()
+	{
+		m_QuestIDsByNPC = new map<int, ref array<int>>;
+		m_UnboundQuestIDs = new array<int>;
+		m_DependentQuestIDs = new map<int, ref array<int>>;
+	}
+
+	void Build(map<int, ref ExpansionQuestConfig> questConfigs)
+	{
+		auto trace = EXTrace.Start(EXTrace.QUESTS, this);
+
+		m_QuestIDsByNPC.Clear();
+		m_UnboundQuestIDs.Clear();
+		m_DependentQuestIDs.Clear();
+
+		if (!questConfigs)
+			return;
+
+		array<int> giverIDs;
+		array<int> turnInIDs;
+
+		//! Collect all NPC IDs first so every per-NPC list can be filled in config order
+		foreach (int questID, ExpansionQuestConfig config: questConfigs)
+		{
+			giverIDs = config.GetQuestGiverIDs();
+			foreach (int giverID: giverIDs)
+			{
+				if (!m_QuestIDsByNPC.Contains(giverID))
+					m_QuestIDsByNPC.Insert(giverID, new array<int>);
+			}
+
+			turnInIDs = config.GetQuestTurnInIDs();
+			foreach (int turnInID: turnInIDs)
+			{
+				if (!m_QuestIDsByNPC.Contains(turnInID))
+					m_QuestIDsByNPC.Insert(turnInID, new array<int>);
+			}
+
+			array<int> preQuestIDs = config.GetPreQuestIDs();
+			foreach (int preQuestID: preQuestIDs)
+			{
+				AddDependent(preQuestID, questID);
+			}
+
+			if (config.GetFollowUpQuestID() > 0)
+				AddDependent(questID, config.GetFollowUpQuestID());
+		}
+
+		foreach (int id, ExpansionQuestConfig questConfig: questConfigs)
+		{
+			bool unbound = IsUnbound(questConfig);
+			if (unbound)
+				m_UnboundQuestIDs.Insert(id);
+
+			giverIDs = questConfig.GetQuestGiverIDs();
+			turnInIDs = questConfig.GetQuestTurnInIDs();
+
+			foreach (int npcID, array<int> questIDs: m_QuestIDsByNPC)
+			{
+				if (unbound || giverIDs.Find(npcID) > -1 || turnInIDs.Find(npcID) > -1)
+					questIDs.Insert(id);
+			}
+		}
+
+		EXTrace.Add(trace, "NPCs: " + m_QuestIDsByNPC.Count() + " | Unbound quests: " + m_UnboundQuestIDs.Count());
+	}
+
+	//! Quests that pass the NPC check of QuestDisplayConditions for any NPC.
+	//! Repeatable quests are included because a completed repeatable quest skips the giver/turn-in check.
+	protected bool IsUnbound(ExpansionQuestConfig config)
+	{
+		if (config.IsRepeatable())
+			return true;
+
+		array<int> giverIDs = config.GetQuestGiverIDs();
+		if (!giverIDs || giverIDs.Count() == 0)
+			return true;
+
+		array<int> turnInIDs = config.GetQuestTurnInIDs();
+		if (!turnInIDs || turnInIDs.Count() == 0)
+			return true;
+
+		return false;
+	}
+
+	protected void AddDependent(int questID, int dependentQuestID)
+	{
+		array<int> dependents = m_DependentQuestIDs[questID];
+		if (!dependents)
+		{
+			dependents = new array<int>;
+			m_DependentQuestIDs.Insert(questID, dependents);
+		}
+
+		if (dependents.Find(dependentQuestID) == -1)
+			dependents.Insert(dependentQuestID);
+	}
+
+	/**
+	 * @brief Get IDs of all quests that can possibly be displayed on the given quest NPC, in quest config order
+	 * @note The result is a superset, ExpansionQuestModule::QuestDisplayConditions still needs to be checked for each quest.
+	 */
+	array<int> GetQuestIDsForNPC(int npcID)
+	{
+		array<int> questIDs = m_QuestIDsByNPC[npcID];
+		if (questIDs)
+			return questIDs;
+
+		return m_UnboundQuestIDs;
+	}
+
+	//! @return IDs of quests whose display conditions depend on the state of the given quest, or NULL if there are none
+	array<int> GetDependentQuestIDs(int questID)
+	{
+		return m_DependentQuestIDs[questID];
+	}
+};
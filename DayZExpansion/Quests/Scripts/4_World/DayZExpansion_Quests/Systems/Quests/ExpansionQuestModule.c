@@ -36,6 +36,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 
 	static ref map<int, ExpansionQuestIndicatorState> s_QuestNPCIndicatorStates = new map<int, ExpansionQuestIndicatorState>; //! Client
 	protected ref map<int, ref ExpansionQuestConfig> m_QuestConfigs; //! Server & Client
+	protected ref ExpansionQuestConfigIndex m_QuestConfigIndex; //! Server & Client
 
 	//! Server only
 	protected ref map<string, ref ExpansionQuestPersistentData> m_PlayerDatas; //! Server
@@ -95,6 +96,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 
 		m_QuestsNPCs = new map<int, ref ExpansionQuestNPCData>; //! Server
 		m_QuestConfigs = new map<int, ref ExpansionQuestConfig>; //! Server
+		m_QuestConfigIndex = new ExpansionQuestConfigIndex(); //! Server & Client
 		m_PlayerDatas = new map<string, ref ExpansionQuestPersistentData>; //! Server
 
 	#ifdef EXPANSIONMODGROUPS
@@ -382,6 +384,8 @@ class ExpansionQuestModule: CF_ModuleWorld
 				DefaultQuestData(); //! Server: Create default quest data on the server and load them into m_QuestConfigs.
 			}
 
+			m_QuestConfigIndex.Build(m_QuestConfigs);
+
 			//! GET QUEST OBJECT SETS FROM QUESTS
 			LoadObjectSets();
 
@@ -439,6 +443,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 		if (GetExpansionSettings().GetQuest().EnableQuests)
 		{
 			CleanupPlayerQuests(cArgs.UID);
+			ExpansionQuestPersistence.Flush(EXPANSION_QUESTS_PLAYERDATA_FOLDER, cArgs.UID);
 			m_PlayerDatas.Remove(cArgs.UID);
 		}
 	}
@@ -463,6 +468,9 @@ class ExpansionQuestModule: CF_ModuleWorld
 					quest.OnQuestCleanup();
 				}
 			}
+
+			//! Write everything that is still pending in the write-behind cache
+			ExpansionQuestPersistence.FlushAll();
 		}
 	#endif
 	}
@@ -496,8 +504,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 			questPlayerData = new ExpansionQuestPersistentData();
 			m_PlayerDatas.Insert(playerUID, questPlayerData);
 
-			string path = EXPANSION_QUESTS_PLAYERDATA_FOLDER + playerUID + ".bin";
-			if (!FileExist(path))
+			if (!ExpansionQuestPersistentData.FileExists(playerUID, EXPANSION_QUESTS_PLAYERDATA_FOLDER))
 			{
 				GetExpansionSettings().GetLog().PrintLog("[Expansion Quests] - InitQuestSystemClient - Created new persistent player quest data for player UID: " + playerUID);
 			}
@@ -649,8 +656,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 			//! If we don't have cached group quest data, check if file exists and load it, else use fresh instance as-is
 			questGroupData = new ExpansionQuestPersistentData();
 			m_PlayerDatas.Insert(groupID, questGroupData);
-			string path = EXPANSION_QUESTS_GROUPDATA_FOLDER + groupID + ".bin";
-			if (!FileExist(path))
+			if (!ExpansionQuestPersistentData.FileExists(groupID, EXPANSION_QUESTS_GROUPDATA_FOLDER))
 			{
 				GetExpansionSettings().GetLog().PrintLog("[Expansion Quests] - LoadGroupQuestData - Created new persistent group quest data for group with ID: " + groupID);
 			}
@@ -1035,6 +1041,10 @@ class ExpansionQuestModule: CF_ModuleWorld
 		else
 			EXPrint(this, "WARNING: Received zero quest configs!");
 
+		m_QuestConfigIndex.Build(m_QuestConfigs);
+		if (m_ClientQuestData)
+			m_ClientQuestData.ClearDisplayConditionsCache();
+
 		return true;
 	}
 
@@ -1144,6 +1154,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 			if (data.m_RemoveQuestData)
 			{
 				m_ClientQuestData.QuestData.Remove(questID);
+				m_ClientQuestData.InvalidateDisplayConditions(questID);
 				EXPrint(this, "Removed quest data for quest ID " + questID);
 			}
 			else
@@ -1152,6 +1163,7 @@ class ExpansionQuestModule: CF_ModuleWorld
 				if (questData)
 				{
 					m_ClientQuestData.QuestData[questID] = questData;
+					m_ClientQuestData.InvalidateDisplayConditions(questID);
 					EXPrint(this, "Updated quest data for quest ID " + questID);
 				}
 				else
@@ -3685,6 +3697,12 @@ class ExpansionQuestModule: CF_ModuleWorld
 		return m_QuestConfigs;
 	}
 
+	//! Server & Client
+	ExpansionQuestConfigIndex GetQuestConfigIndex()
+	{
+		return m_QuestConfigIndex;
+	}
+
 	//! Server & Client
 	ExpansionQuestNPCData GetQuestNPCDataByID(int id)
 	{
@@ -4389,6 +4407,53 @@ class ExpansionQuestModule: CF_ModuleWorld
 		if (!player || !player.GetIdentity())
 			return false;
 
+		//! Results only depending on the quest states of the player are cached in the persistent data
+		//! and invalidated when the state of the quest or one of its pre-quests changes.
+		if (!playerQuestData || !CanCacheDisplayConditions(config, displayQuestsWithCooldown))
+			return EvaluateQuestDisplayConditions(config, player, playerQuestData, questNPCID, displayQuestsWithCooldown);
+
+		int questID = config.GetID();
+		int cacheKey = questNPCID * 2;
+		if (displayQuestsWithCooldown)
+			cacheKey += 1;
+
+		bool result;
+		if (playerQuestData.FindDisplayConditions(questID, cacheKey, result))
+			return result;
+
+		result = EvaluateQuestDisplayConditions(config, player, playerQuestData, questNPCID, displayQuestsWithCooldown);
+		playerQuestData.SetDisplayConditions(questID, cacheKey, result);
+
+		return result;
+	}
+
+	//! Quests with cooldowns, reputation or faction requirements depend on more than the quest states and are always evaluated
+	protected bool CanCacheDisplayConditions(ExpansionQuestConfig config, bool displayQuestsWithCooldown)
+	{
+		if (config.IsRepeatable() && !displayQuestsWithCooldown)
+			return false;
+
+	#ifdef EXPANSIONMODHARDLINE
+		if (config.GetReputationRequirement() > 0)
+			return false;
+	#endif
+
+	#ifdef EXPANSIONMODAI
+		if (config.GetRequiredFaction() != string.Empty || config.GetFactionReward() != string.Empty)
+			return false;
+
+	#ifdef EXPANSIONMODHARDLINE
+		if (config.GetFactionReputationRequirements().Count() > 0)
+			return false;
+	#endif
+	#endif
+
+		return true;
+	}
+
+	protected bool EvaluateQuestDisplayConditions(ExpansionQuestConfig config, PlayerBase player, ExpansionQuestPersistentData playerQuestData, int questNPCID, bool displayQuestsWithCooldown)
+	{
+
 		string playerUID = player.GetIdentity().GetId();
 		int questID = config.GetID();
 		string stateText;
@@ -0,0 +1,81 @@
+/**
+ * ExpansionQuestPersistence.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+//! Write-behind cache for persistent player and group quest data.
+//! ExpansionQuestPersistentData::Save only marks the data as dirty, the actual file write happens at most once per FLUSH_INTERVAL,
+//! on player disconnect and on mission finish.
+class ExpansionQuestPersistence
+{
+	static const int FLUSH_INTERVAL = 30000;
+
+	//! Keep a strong ref so pending changes are still written if the module drops the data in the meantime (e.g. on disconnect)
+	protected static ref map<string, ref ExpansionQuestPersistentData> s_Dirty = new map<string, ref ExpansionQuestPersistentData>;
+	protected static bool s_FlushScheduled;
+
+	static string GetKey(string folder, string fileName)
+	{
+		return folder + fileName;
+	}
+
+	static void MarkDirty(ExpansionQuestPersistentData data)
+	{
+		string key = GetKey(data.m_Folder, data.m_FileName);
+		if (!s_Dirty.Contains(key))
+			s_Dirty.Insert(key, data);
+
+		if (!s_FlushScheduled)
+		{
+			s_FlushScheduled = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(FlushAll, FLUSH_INTERVAL);
+		}
+	}
+
+	static bool IsDirty(string folder, string fileName)
+	{
+		return s_Dirty.Contains(GetKey(folder, fileName));
+	}
+
+	//! Write pending changes of a single data file, if any
+	static void Flush(string folder, string fileName)
+	{
+		string key = GetKey(folder, fileName);
+		ExpansionQuestPersistentData data = s_Dirty.Get(key);
+		if (!data)
+			return;
+
+		s_Dirty.Remove(key);
+		data.SaveNow();
+	}
+
+	static void FlushAll()
+	{
+		auto trace = EXTrace.Start(EXTrace.QUESTS, ExpansionQuestPersistence, "" + s_Dirty.Count());
+
+		if (s_FlushScheduled)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(FlushAll);
+			s_FlushScheduled = false;
+		}
+
+		foreach (string key, ExpansionQuestPersistentData data: s_Dirty)
+		{
+			data.SaveNow();
+		}
+
+		s_Dirty.Clear();
+	}
+
+	static int Count()
+	{
+		return s_Dirty.Count();
+	}
+}
@@ -16,6 +16,9 @@ class ExpansionQuestPersistentData
 	[NonSerialized()];
 	string m_FileName;
 
+	[NonSerialized()];
+	string m_Folder;
+
 	static const int DATAVERSION = 2;
 	int DataVersion;
 	ref map<int, ref ExpansionQuestPersistentQuestData> QuestData = new map<int, ref ExpansionQuestPersistentQuestData>;
@@ -26,6 +29,10 @@ class ExpansionQuestPersistentData
 	[NonSerialized()]
 	bool m_RemoveQuestData;
 
+	//! Cached QuestDisplayConditions results, quest ID -> (cache key -> result), see ExpansionQuestModule::QuestDisplayConditions
+	[NonSerialized()]
+	ref map<int, ref map<int, bool>> m_DisplayConditionsCache = new map<int, ref map<int, bool>>;
+
 	void ~ExpansionQuestPersistentData()
 	{
 		if (QuestData)
@@ -50,6 +57,7 @@ class ExpansionQuestPersistentData
 		questData.State = state;
 		questData.UpdateLastUpdateTime();
 		QuestData[questID] = questData;
+		InvalidateDisplayConditions(questID);
 
 		m_SynchDirty = true;
 	}
@@ -64,6 +72,7 @@ class ExpansionQuestPersistentData
 			QuestDebugPrint("Remove data for quest ID: " + currentData.QuestID);
 			currentData.ClearObjectiveData();
 			QuestData.Remove(questID);
+			InvalidateDisplayConditions(questID);
 			m_SynchDirty = true;
 		}
 	}
@@ -146,6 +155,7 @@ class ExpansionQuestPersistentData
 		questData.State = state;
 		questData.UpdateLastUpdateTime();
 		questData.QuestDebug();
+		InvalidateDisplayConditions(questID);
 
 		m_SynchDirty = true;
 	}
@@ -193,6 +203,7 @@ class ExpansionQuestPersistentData
 		{
 			questData.CompletionCount = (questData.CompletionCount + 1);
 			questData.UpdateLastUpdateTime();
+			InvalidateDisplayConditions(questID);
 			QuestDebugPrint("Updated completion count for quest. Quest ID: " + questID + " | Completion count: " + questData.CompletionCount);
 			m_SynchDirty = true;
 			return true;
@@ -201,65 +212,170 @@ class ExpansionQuestPersistentData
 		return false;
 	}
 
+	//! Drop cached display conditions of the given quest and of all quests that depend on it (quests that have it as pre-quest and its follow-up quest)
+	void InvalidateDisplayConditions(int questID)
+	{
+		if (m_DisplayConditionsCache.Count() == 0)
+			return;
+
+		m_DisplayConditionsCache.Remove(questID);
+
+		ExpansionQuestModule questModule = ExpansionQuestModule.GetModuleInstance();
+		if (!questModule)
+			return;
+
+		array<int> dependentQuestIDs = questModule.GetQuestConfigIndex().GetDependentQuestIDs(questID);
+		if (!dependentQuestIDs)
+			return;
+
+		foreach (int dependentQuestID: dependentQuestIDs)
+		{
+			m_DisplayConditionsCache.Remove(dependentQuestID);
+		}
+	}
+
+	void ClearDisplayConditionsCache()
+	{
+		m_DisplayConditionsCache.Clear();
+	}
+
+	bool FindDisplayConditions(int questID, int key, out bool result)
+	{
+		map<int, bool> results = m_DisplayConditionsCache[questID];
+		if (!results)
+			return false;
+
+		return results.Find(key, result);
+	}
+
+	void SetDisplayConditions(int questID, int key, bool result)
+	{
+		map<int, bool> results = m_DisplayConditionsCache[questID];
+		if (!results)
+		{
+			results = new map<int, bool>;
+			m_DisplayConditionsCache.Insert(questID, results);
+		}
+
+		results[key] = result;
+	}
+
+	static bool FileExists(string fileName, string folder)
+	{
+		return FileExist(folder + fileName + ".bin") || FileExist(folder + fileName + ".bin.tmp");
+	}
+
 	bool Load(string fileName, string folder)
 	{
 		EXTrace.Print(EXTrace.QUESTS, this, "::Load - Load existing data file: " + fileName);
 
+		//! Make sure we don't read a file that still has changes pending in the write-behind cache
+		ExpansionQuestPersistence.Flush(folder, fileName);
+
 		m_FileName = fileName;
+		m_Folder = folder;
 
 		string path = folder + fileName + ".bin";
-		FileSerializer file = new FileSerializer();
 		bool save;
-		if (file.Open(path, FileMode.READ))
-		{
-			file.Read(DataVersion);
-			EXTrace.Print(EXTrace.QUESTS, this, "::Load - Data version of file " + fileName + " is " + DataVersion + ".");
-
-			bool success = OnRead(file);
 
-			file.Close();
-
-			if (!success)
-				return false;
-
-			if (DataVersion < DATAVERSION)
+		//! A temp file is only left behind if the server went down while saving. If it is complete, it is the most recent data.
+		if (FileExist(path + ".tmp"))
+		{
+			if (Read(path + ".tmp"))
 			{
-				EXTrace.Print(EXTrace.QUESTS, this, "::Load - Data conversion from version " + DataVersion + " to version " + DATAVERSION + " completed for file: " + fileName);
+				EXPrint(this, "::Load - Recovered " + fileName + " from temp file");
 				save = true;
-				DataVersion = DATAVERSION;
 			}
+			else if (!Read(path))
+			{
+				return false;
+			}
+
+			DeleteFile(path + ".tmp");
 		}
-		else
+		else if (!Read(path))
 		{
 			return false;
 		}
 
+		if (DataVersion < DATAVERSION)
+		{
+			EXTrace.Print(EXTrace.QUESTS, this, "::Load - Data conversion from version " + DataVersion + " to version " + DATAVERSION + " completed for file: " + fileName);
+			save = true;
+			DataVersion = DATAVERSION;
+		}
+
 		if (DataCheck())
 			save = true;
 
 		if (save)
-			Save(fileName, folder);
+			SaveNow();
 
 		m_SynchDirty = true;
 
 		return true;
 	}
 
+	protected bool Read(string path)
+	{
+		FileSerializer file = new FileSerializer();
+		if (!file.Open(path, FileMode.READ))
+			return false;
+
+		QuestData.Clear();
+
+		file.Read(DataVersion);
+		EXTrace.Print(EXTrace.QUESTS, this, "::Read - Data version of file " + path + " is " + DataVersion + ".");
+
+		bool success = OnRead(file);
+
+		file.Close();
+
+		return success;
+	}
+
+	//! Mark data as changed. The file is written by ExpansionQuestPersistence at most once per flush interval.
 	void Save(string fileName, string path)
 	{
 		auto trace = EXTrace.Start(EXTrace.QUESTS, this, fileName);
 
+		m_FileName = fileName;
+		m_Folder = path;
+
+		ExpansionQuestPersistence.MarkDirty(this);
+	}
+
+	//! Write data to disk immediately. Data is written to a temp file first so a crash while saving can't leave a truncated file behind.
+	bool SaveNow()
+	{
+		auto trace = EXTrace.Start(EXTrace.QUESTS, this, m_FileName);
+
+		string path = m_Folder + m_FileName + ".bin";
+		string tmpPath = path + ".tmp";
+
 		FileSerializer file = new FileSerializer();
-		if (file.Open(path + fileName + ".bin", FileMode.WRITE))
+		if (!file.Open(tmpPath, FileMode.WRITE))
 		{
-			file.Write(DataVersion);
-			OnWrite(file, false);
-			file.Close();
+			Error("Could not open " + tmpPath + " for writing!");
+			return false;
 		}
-		else
+
+		file.Write(DataVersion);
+		OnWrite(file, false);
+		file.Close();
+
+		if (FileExist(path))
+			DeleteFile(path);
+
+		if (!CopyFile(tmpPath, path))
 		{
-			Error("Could not open " + path + fileName + ".bin" + " for writing!");
+			Error("Could not move " + tmpPath + " to " + path + "!");
+			return false;
 		}
+
+		DeleteFile(tmpPath);
+
+		return true;
 	}
 
 	protected bool DataCheck()
@@ -416,6 +532,7 @@ class ExpansionQuestPersistentData
 		auto trace = EXTrace.Start(EXTrace.QUESTS, this);
 
 		QuestData.Clear();
+		ClearDisplayConditionsCache();
 
 		int dataCount;
 		if (!ctx.Read(dataCount))
@@ -265,9 +265,20 @@ class ExpansionQuestMenu: ExpansionScriptViewMenu
 		
 		ExpansionQuestConfig questToShow;
 		ExpansionQuestMenuListEntry questEntry;
+		//! Only check quests that can be displayed on this NPC at all.
+		array<int> questIDs;
+		if (questNPCID > -1)
+			questIDs = ExpansionQuestModule.GetModuleInstance().GetQuestConfigIndex().GetQuestIDsForNPC(questNPCID);
+		else
+			questIDs = m_ClientQuestConfigs.GetKeyArray();
+
 		//! Check quest configurations array for valid quests to display.
-		foreach (ExpansionQuestConfig questConfig: m_ClientQuestConfigs)
+		foreach (int configQuestID: questIDs)
 		{
+			ExpansionQuestConfig questConfig = m_ClientQuestConfigs[configQuestID];
+			if (!questConfig)
+				continue;
+
 			QuestDebug(ToString() + "::SetQuests - Checking if quest " + questConfig.GetID() + " should be displayed..");
 			if (!ExpansionQuestModule.GetModuleInstance().QuestDisplayConditions(questConfig, player, m_ClientQuestData, questNPCID, true))
 			{
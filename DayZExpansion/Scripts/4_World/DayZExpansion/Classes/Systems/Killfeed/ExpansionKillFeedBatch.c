@@ -0,0 +1,161 @@
+/**
+ * ExpansionKillFeedBatch.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+//! Queued killfeed message, server only
+class ExpansionKillFeedEntry
+{
+	ExpansionKillFeedMessageType m_Type;
+	string m_Icon;
+	ref array<string> m_Params;
+
+	//! Players involved in the message, they always receive it even if the batch is capped
+	PlayerBase m_Victim;
+	PlayerBase m_Killer;
+
+	void ExpansionKillFeedEntry(ExpansionKillFeedMessageType type, string icon, PlayerBase victim, PlayerBase killer)
+	{
+		m_Type = type;
+		m_Icon = icon;
+		m_Params = new array<string>;
+		m_Victim = victim;
+		m_Killer = killer;
+	}
+
+	void AddParam(string param)
+	{
+		m_Params.Insert(param);
+	}
+}
+
+/**@class		ExpansionKillFeedBatch
+ * @brief		Killfeed messages sent to one recipient (or everyone) in a single RPC
+ *
+ * Messages are sent as type codes instead of stringtable keys, and icons and params are written once into a string table
+ * that entries reference by index, so a burst of deaths with the same killer, vehicle or weapon only sends those strings once.
+ * Trailing empty params are not sent.
+ **/
+class ExpansionKillFeedBatch
+{
+	PlayerIdentity m_Recipient;  //! NULL = everyone
+	ref array<ExpansionKillFeedEntry> m_Entries;
+
+	void ExpansionKillFeedBatch(PlayerIdentity recipient = null)
+	{
+		m_Recipient = recipient;
+		m_Entries = new array<ExpansionKillFeedEntry>;
+	}
+
+	void Write(ParamsWriteContext ctx)
+	{
+		map<string, int> indices = new map<string, int>;
+		array<string> strings = new array<string>;
+		array<int> data = new array<int>;
+
+		foreach (ExpansionKillFeedEntry entry: m_Entries)
+		{
+			int paramCount = entry.m_Params.Count();
+			while (paramCount > 0 && entry.m_Params[paramCount - 1] == string.Empty)
+			{
+				paramCount--;
+			}
+
+			data.Insert(entry.m_Type);
+			data.Insert(GetStringIndex(entry.m_Icon, indices, strings));
+			data.Insert(paramCount);
+
+			for (int i = 0; i < paramCount; i++)
+			{
+				data.Insert(GetStringIndex(entry.m_Params[i], indices, strings));
+			}
+		}
+
+		ctx.Write(strings);
+		ctx.Write(m_Entries.Count());
+		ctx.Write(data);
+	}
+
+	protected int GetStringIndex(string value, map<string, int> indices, array<string> strings)
+	{
+		int index;
+		if (!indices.Find(value, index))
+		{
+			index = strings.Insert(value);
+			indices.Insert(value, index);
+		}
+
+		return index;
+	}
+
+	static bool Read(ParamsReadContext ctx, notnull array<ref ExpansionKillFeedMessageMetaData> messages)
+	{
+		array<string> strings;
+		if (!ctx.Read(strings))
+			return false;
+
+		int count;
+		if (!ctx.Read(count))
+			return false;
+
+		array<int> data;
+		if (!ctx.Read(data))
+			return false;
+
+		int stringCount = strings.Count();
+		int dataCount = data.Count();
+		int pos;
+
+		for (int i = 0; i < count; i++)
+		{
+			if (pos + 3 > dataCount)
+				return false;
+
+			ExpansionKillFeedMessageType type = data[pos];
+			int iconIndex = data[pos + 1];
+			int paramCount = data[pos + 2];
+			pos += 3;
+
+			if (iconIndex < 0 || iconIndex >= stringCount || paramCount > 4 || pos + paramCount > dataCount)
+				return false;
+
+			auto message = new ExpansionKillFeedMessageMetaData(type, strings[iconIndex]);
+
+			for (int j = 0; j < paramCount; j++)
+			{
+				int paramIndex = data[pos + j];
+				if (paramIndex < 0 || paramIndex >= stringCount)
+					return false;
+
+				switch (j)
+				{
+					case 0:
+						message.FeedParam1 = strings[paramIndex];
+						break;
+					case 1:
+						message.FeedParam2 = strings[paramIndex];
+						break;
+					case 2:
+						message.FeedParam3 = strings[paramIndex];
+						break;
+					case 3:
+						message.FeedParam4 = strings[paramIndex];
+						break;
+				}
+			}
+
+			pos += paramCount;
+
+			messages.Insert(message);
+		}
+
+		return true;
+	}
+}
@@ -13,6 +13,9 @@
 [CF_RegisterModule(ExpansionKillFeedModule)]
 class ExpansionKillFeedModule: CF_ModuleWorld
 {
+	static const int BATCH_WINDOW = 250;  //! ms deaths are collected before they are sent
+	static const int MAX_BROADCAST_MESSAGES_PER_BATCH = 5;  //! Messages per flush sent to everyone, further ones only go to the players involved in them
+
 	private string m_PlayerName;
 	private string m_PlayerSteamWebhook;
 
@@ -29,6 +32,10 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 
 	private bool m_HitCheckDone;
 
+	protected ref array<ref ExpansionKillFeedEntry> m_Queue = new array<ref ExpansionKillFeedEntry>;
+	protected bool m_FlushScheduled;
+	protected int m_DroppedMessages;
+
 #ifdef JM_COT
 	protected JMWebhookModule m_Webhook;
 #endif
@@ -40,7 +47,7 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 		super.OnInit();
 
 		Expansion_EnableRPCManager();
-		Expansion_RegisterClientRPC("RPC_SendMessage");
+		Expansion_RegisterClientRPC("RPC_SendMessages");
 
 #ifdef JM_COT
 		CF_Modules<JMWebhookModule>.Get(m_Webhook);
@@ -124,7 +131,10 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 		m_PlayerName = GetIdentityName( player );
 
 		#ifdef JM_COT
-		m_PlayerSteamWebhook = player.FormatSteamWebhook();
+		if (GetExpansionSettings().GetNotification().EnableKillFeedDiscordMsg)
+			m_PlayerSteamWebhook = player.FormatSteamWebhook();
+		else
+			m_PlayerSteamWebhook = "";
 		#endif
 
 		m_PlayerName2 = "";
@@ -283,7 +293,7 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 					m_PlayerName2 = GetIdentityName( m_SourcePlayer );
 
 					#ifdef JM_COT
-					if ( m_SourcePlayer.GetIdentity() )
+					if ( m_SourcePlayer.GetIdentity() && GetExpansionSettings().GetNotification().EnableKillFeedDiscordMsg )
 						m_PlayerSteamWebhook2 = m_SourcePlayer.FormatSteamWebhook();
 					#endif
 				}
@@ -531,7 +541,7 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 				{
 					if (formatted_names)
 						formatted_names += ", ";
-					formatted_names = current_name;
+					formatted_names += current_name;
 				}
 
 #ifdef EXPANSIONMODVEHICLE
@@ -626,7 +636,7 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 			m_PlayerName2 = GetIdentityName( m_SourcePlayer );
 	
 			#ifdef JM_COT
-			if ( m_SourcePlayer.GetIdentity() )
+			if ( m_SourcePlayer.GetIdentity() && GetExpansionSettings().GetNotification().EnableKillFeedDiscordMsg )
 				m_PlayerSteamWebhook2 = m_SourcePlayer.FormatSteamWebhook();
 			#endif
 
@@ -666,7 +676,7 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 			m_PlayerName2 = GetIdentityName( m_SourcePlayer );
 
 			#ifdef JM_COT
-			if ( m_SourcePlayer.GetIdentity() )
+			if ( m_SourcePlayer.GetIdentity() && GetExpansionSettings().GetNotification().EnableKillFeedDiscordMsg )
 				m_PlayerSteamWebhook2 = m_SourcePlayer.FormatSteamWebhook();
 			#endif
 
@@ -727,21 +737,103 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 		DoKillfeed(ExpansionKillFeedMessageType.DIED_UNKNOWN, "Human Skull");
 	}
 
-	//! @note Called on Server
+	//! @note Called on Server. Queues the message, deaths within BATCH_WINDOW are sent together.
 	private void KillFeedMessage( ExpansionKillFeedMessageType type, string icon, string param1 = "", string param2 = "", string param3 = "", string param4 = "")
 	{
 		if ( GetGame().IsServer() )
 		{
-			ExpansionKillFeedMessageMetaData kill_data = new ExpansionKillFeedMessageMetaData(type, icon, param1, param2, param3, param4);
+			ExpansionKillFeedEntry entry = new ExpansionKillFeedEntry(type, icon, m_Player, m_SourcePlayer);
+			entry.AddParam(param1);
+			entry.AddParam(param2);
+			entry.AddParam(param3);
+			entry.AddParam(param4);
 
-			auto message_rpc = Expansion_CreateRPC("RPC_SendMessage");
-			message_rpc.Write( kill_data );
-			message_rpc.Expansion_Send(true);
+			m_Queue.Insert(entry);
 
-			ExpansionLogKillfeed(kill_data);
+			if (!m_FlushScheduled)
+			{
+				GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(FlushKillFeed, BATCH_WINDOW);
+				m_FlushScheduled = true;
+			}
+
+			if (GetExpansionSettings().GetLog().Killfeed)
+				ExpansionLogKillfeed(new ExpansionKillFeedMessageMetaData(type, icon, param1, param2, param3, param4));
 		}
 	}
 
+	//! @note Called on Server. Sends queued messages in one pass: the first MAX_BROADCAST_MESSAGES_PER_BATCH go to everyone,
+	//! the rest are dropped except for the players involved in them, who get them in a batch of their own.
+	protected void FlushKillFeed()
+	{
+		m_FlushScheduled = false;
+
+		int count = m_Queue.Count();
+		if (count == 0)
+			return;
+
+		auto trace = EXTrace.Start(EXTrace.KILLFEED, this, "" + count);
+
+		ExpansionKillFeedBatch broadcast = new ExpansionKillFeedBatch();
+		map<string, ref ExpansionKillFeedBatch> personal = new map<string, ref ExpansionKillFeedBatch>;
+
+		foreach (int i, ExpansionKillFeedEntry entry: m_Queue)
+		{
+			if (i < MAX_BROADCAST_MESSAGES_PER_BATCH)
+			{
+				broadcast.m_Entries.Insert(entry);
+				continue;
+			}
+
+			m_DroppedMessages++;
+
+			AddPersonalMessage(personal, entry.m_Victim, entry);
+			if (entry.m_Killer != entry.m_Victim)
+				AddPersonalMessage(personal, entry.m_Killer, entry);
+		}
+
+		SendMessages(broadcast);
+
+		foreach (string uid, ExpansionKillFeedBatch batch: personal)
+		{
+			SendMessages(batch);
+		}
+
+		if (count > MAX_BROADCAST_MESSAGES_PER_BATCH)
+			EXTrace.Print(EXTrace.KILLFEED, this, "Dropped " + (count - MAX_BROADCAST_MESSAGES_PER_BATCH) + " messages from broadcast (total " + m_DroppedMessages + ")");
+
+		m_Queue.Clear();
+	}
+
+	protected void AddPersonalMessage(map<string, ref ExpansionKillFeedBatch> personal, PlayerBase player, ExpansionKillFeedEntry entry)
+	{
+		if (!player || !player.GetIdentity())
+			return;
+
+		string uid = player.GetIdentity().GetId();
+
+		ExpansionKillFeedBatch batch = personal[uid];
+		if (!batch)
+		{
+			batch = new ExpansionKillFeedBatch(player.GetIdentity());
+			personal.Insert(uid, batch);
+		}
+
+		batch.m_Entries.Insert(entry);
+	}
+
+	protected void SendMessages(ExpansionKillFeedBatch batch)
+	{
+		auto rpc = Expansion_CreateRPC("RPC_SendMessages");
+		batch.Write(rpc);
+		rpc.Expansion_Send(true, batch.m_Recipient);
+	}
+
+	//! @return Number of messages that were not broadcast because of MAX_BROADCAST_MESSAGES_PER_BATCH since server start
+	int GetDroppedMessageCount()
+	{
+		return m_DroppedMessages;
+	}
+
 	private bool KillFeedCheckServerSettings( ExpansionKillFeedMessageType type )
 	{
 		switch ( type )
@@ -981,11 +1073,23 @@ class ExpansionKillFeedModule: CF_ModuleWorld
 	}
 
 	//! @note Called on all Clients
-	private void RPC_SendMessage(PlayerIdentity sender, Object target, ParamsReadContext ctx)
+	private void RPC_SendMessages(PlayerIdentity sender, Object target, ParamsReadContext ctx)
 	{
-		ExpansionKillFeedMessageMetaData kill_data = new ExpansionKillFeedMessageMetaData( ExpansionKillFeedMessageType.UNKNOWN, "" );
-		ctx.Read(kill_data);
+		array<ref ExpansionKillFeedMessageMetaData> messages = new array<ref ExpansionKillFeedMessageMetaData>;
+		if (!ExpansionKillFeedBatch.Read(ctx, messages))
+		{
+			Error("Couldn't read killfeed messages");
+			return;
+		}
+
+		foreach (ExpansionKillFeedMessageMetaData kill_data: messages)
+		{
+			ShowMessage(kill_data);
+		}
+	}
 
+	private void ShowMessage(ExpansionKillFeedMessageMetaData kill_data)
+	{
 		if (kill_data)
 		{
 			auto trace = EXTrace.Start(EXTrace.KILLFEED, this, kill_data.Message, kill_data.Icon, kill_data.FeedParam1, kill_data.FeedParam2, kill_data.FeedParam3, kill_data.FeedParam4);
@@ -16,14 +16,45 @@ class IviesPosition
 	float   	radius;	
 }
 
+/**@class		ExpansionInteriorBuildingModule
+ * @brief		Loads interiors and ivies of all buildings that have them
+ *
+ * Server loads interiors map-wide. Client streams them in: only buildings within STREAM_RADIUS of the camera
+ * get their interior/ivy objects, and they are deleted again beyond STREAM_UNLOAD_RADIUS.
+ * Buildings register themselves on construction and are put in a coarse grid on the first stream pass after that
+ * (their position isn't known yet in the constructor). Loads are spread over frames.
+ **/
 [CF_RegisterModule(ExpansionInteriorBuildingModule)]
 class ExpansionInteriorBuildingModule: CF_ModuleWorld
 {
+	static const float STREAM_RADIUS = 300.0;
+	static const float STREAM_UNLOAD_RADIUS = 400.0;  //! Hysteresis, loaded buildings are only unloaded beyond this
+	static const float STREAM_MOVE_THRESHOLD = 25.0;  //! Camera movement before nearby buildings are queried again
+	static const int STREAM_INTERVAL = 500;
+	static const int STREAM_LOADS_PER_FRAME = 2;
+
+	static const float BUILDING_CELL_SIZE = 100.0;
+	static const float IVY_CELL_SIZE = 50.0;
+	static const int CELL_ROW = 1024;  //! Max cells per row
+
+	//! Buildings with interior or ivies
+	protected static ref array<BuildingBase> s_Buildings = new array<BuildingBase>;
+	protected static ref array<BuildingBase> s_UnindexedBuildings = new array<BuildingBase>;
+	protected static ref map<int, ref array<BuildingBase>> s_BuildingGrid = new map<int, ref array<BuildingBase>>;
+
 	autoptr array< ref IviesPosition > m_WhereIviesObjectsSpawn;
+	protected ref map<int, ref array<IviesPosition>> m_IvyGrid;
 	
 	//string is classname of the object, and bool, to know if it has collision or not
 	autoptr map<string, bool> m_CachedCollision;
 	protected int m_LastSavedCount;
+
+	protected ref array<BuildingBase> m_StreamedBuildings;  //! Loaded or pending
+	protected ref array<BuildingBase> m_PendingBuildings;
+	protected vector m_LastStreamPosition;
+	protected bool m_ForceStream;
+	protected bool m_IsStreaming;
+	protected bool m_IsLoadingPending;
  	
 	// ------------------------------------------------------------
 	// ExpansionInteriorBuildingModule Constructor
@@ -35,6 +66,8 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 #endif
 
 		m_CachedCollision = new map<string, bool>;
+		m_StreamedBuildings = new array<BuildingBase>;
+		m_PendingBuildings = new array<BuildingBase>;
 
 		ExpansionSettings.SI_General.Insert( OnSettingsUpdated );
 	}
@@ -49,6 +82,8 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 #endif
 		
 		ExpansionSettings.SI_General.Remove( OnSettingsUpdated );
+
+		StopStreaming();
 	}
 	
 	// ------------------------------------------------------------
@@ -59,17 +94,27 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 		super.OnInit();
 
 		EnableMissionStart();
+		EnableMissionFinish();
 	}
  	
  	override void OnMissionStart(Class sender, CF_EventArgs args)
  	{
 		super.OnMissionStart(sender, args);
 
-		BuildingBase.s_Expansion_LoadCustomObjectsDelay = 1000;
-
 		LoadCachedCollisions();
 	}
 
+	override void OnMissionFinish(Class sender, CF_EventArgs args)
+	{
+		super.OnMissionFinish(sender, args);
+
+		StopStreaming();
+
+		//! The game deletes the objects on mission end
+		m_StreamedBuildings.Clear();
+		m_PendingBuildings.Clear();
+	}
+
 	void OnSettingsUpdated()
 	{
 #ifdef EXPANSIONTRACE
@@ -80,8 +125,245 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 		{
 			LoadIviesPositions();
 			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(SaveCachedCollisions, 20000, false);
+
+			//! Settings may have changed what to load, stream in again from scratch
+			UnloadStreamedBuildings();
+			StartStreaming();
+		}
+		else
+		{
+			foreach (BuildingBase building: s_Buildings)
+			{
+				if (building)
+					building.OnSettingsUpdated();
+			}
+		}
+	}
+
+	static void RegisterBuilding(BuildingBase building)
+	{
+		if (building.m_Expansion_StreamIndex != -1)
+			return;
+
+		building.m_Expansion_StreamIndex = s_Buildings.Insert(building);
+
+		if (!GetGame().IsDedicatedServer())
+			s_UnindexedBuildings.Insert(building);
+	}
+
+	static void UnregisterBuilding(BuildingBase building)
+	{
+		int index = building.m_Expansion_StreamIndex;
+		if (index == -1)
+			return;
+
+		building.m_Expansion_StreamIndex = -1;
+
+		int last = s_Buildings.Count() - 1;
+		if (index < last)
+		{
+			BuildingBase moved = s_Buildings[last];
+			s_Buildings[index] = moved;
+			if (moved)
+				moved.m_Expansion_StreamIndex = index;
+		}
+
+		s_Buildings.Remove(last);
+
+		if (building.m_Expansion_StreamCell != -1)
+		{
+			array<BuildingBase> cellBuildings = s_BuildingGrid[building.m_Expansion_StreamCell];
+			if (cellBuildings)
+				cellBuildings.RemoveItem(building);
+
+			building.m_Expansion_StreamCell = -1;
+		}
+	}
+
+	protected void StartStreaming()
+	{
+		m_ForceStream = true;
+
+		if (m_IsStreaming)
+			return;
+
+		m_IsStreaming = true;
+
+		Stream();
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Stream, STREAM_INTERVAL, true);
+	}
+
+	protected void StopStreaming()
+	{
+		if (m_IsLoadingPending)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(LoadPending);
+			m_IsLoadingPending = false;
+		}
+
+		if (!m_IsStreaming)
+			return;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Stream);
+		m_IsStreaming = false;
+	}
+
+	protected void IndexBuildings()
+	{
+		foreach (BuildingBase building: s_UnindexedBuildings)
+		{
+			if (!building || building.m_Expansion_StreamIndex == -1)
+				continue;
+
+			int cell = GetCell(building.GetPosition(), BUILDING_CELL_SIZE);
+
+			array<BuildingBase> cellBuildings = s_BuildingGrid[cell];
+			if (!cellBuildings)
+			{
+				cellBuildings = new array<BuildingBase>;
+				s_BuildingGrid.Insert(cell, cellBuildings);
+			}
+
+			cellBuildings.Insert(building);
+			building.m_Expansion_StreamCell = cell;
+		}
+
+		s_UnindexedBuildings.Clear();
+	}
+
+	protected void Stream()
+	{
+#ifdef DIAG
+		auto trace = EXTrace.Profile(EXTrace.MAPPING, this);
+#endif
+
+		if (s_UnindexedBuildings.Count())
+		{
+			IndexBuildings();
+			m_ForceStream = true;
+		}
+
+		vector cameraPos = GetGame().GetCurrentCameraPosition();
+
+		if (!m_ForceStream && vector.DistanceSq(cameraPos, m_LastStreamPosition) < STREAM_MOVE_THRESHOLD * STREAM_MOVE_THRESHOLD)
+			return;
+
+		m_ForceStream = false;
+		m_LastStreamPosition = cameraPos;
+
+		//! Unload buildings that are too far away now
+		float unloadRadiusSq = STREAM_UNLOAD_RADIUS * STREAM_UNLOAD_RADIUS;
+		for (int i = m_StreamedBuildings.Count() - 1; i >= 0; i--)
+		{
+			BuildingBase streamed = m_StreamedBuildings[i];
+			if (!streamed)
+			{
+				m_StreamedBuildings.Remove(i);
+				continue;
+			}
+
+			if (vector.DistanceSq(streamed.GetPosition(), cameraPos) <= unloadRadiusSq)
+				continue;
+
+			streamed.UnloadInterior();
+			streamed.UnloadIvys();
+			streamed.m_Expansion_IsStreamed = false;
+
+			m_StreamedBuildings.Remove(i);
+		}
+
+		//! Queue buildings that came into range
+		float radiusSq = STREAM_RADIUS * STREAM_RADIUS;
+
+		int minX = GetCellCoord(cameraPos[0] - STREAM_RADIUS, BUILDING_CELL_SIZE);
+		int maxX = GetCellCoord(cameraPos[0] + STREAM_RADIUS, BUILDING_CELL_SIZE);
+		int minZ = GetCellCoord(cameraPos[2] - STREAM_RADIUS, BUILDING_CELL_SIZE);
+		int maxZ = GetCellCoord(cameraPos[2] + STREAM_RADIUS, BUILDING_CELL_SIZE);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				array<BuildingBase> cellBuildings = s_BuildingGrid[x * CELL_ROW + z];
+				if (!cellBuildings)
+					continue;
+
+				foreach (BuildingBase building: cellBuildings)
+				{
+					if (!building || building.m_Expansion_IsStreamed)
+						continue;
+
+					if (vector.DistanceSq(building.GetPosition(), cameraPos) > radiusSq)
+						continue;
+
+					building.m_Expansion_IsStreamed = true;
+					m_StreamedBuildings.Insert(building);
+					m_PendingBuildings.Insert(building);
+				}
+			}
+		}
+
+		if (m_PendingBuildings.Count() && !m_IsLoadingPending)
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Insert(LoadPending);
+			m_IsLoadingPending = true;
 		}
 	}
+
+	//! Load a few pending buildings per frame to avoid bogging down client
+	protected void LoadPending(float timeslice)
+	{
+		int loaded;
+		while (m_PendingBuildings.Count() && loaded < STREAM_LOADS_PER_FRAME)
+		{
+			BuildingBase building = m_PendingBuildings[0];
+			m_PendingBuildings.RemoveOrdered(0);
+
+			//! Unloaded again before it was loaded
+			if (!building || !building.m_Expansion_IsStreamed)
+				continue;
+
+			bool loadInterior;
+			int loadIvys;
+			if (building.Expansion_GetCustomObjectsToLoad(loadInterior, loadIvys))
+				building.LoadCustomObjects(loadInterior, loadIvys);
+
+			loaded++;
+		}
+
+		if (!m_PendingBuildings.Count())
+		{
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(LoadPending);
+			m_IsLoadingPending = false;
+		}
+	}
+
+	protected void UnloadStreamedBuildings()
+	{
+		foreach (BuildingBase building: m_StreamedBuildings)
+		{
+			if (!building)
+				continue;
+
+			building.UnloadInterior();
+			building.UnloadIvys();
+			building.m_Expansion_IsStreamed = false;
+		}
+
+		m_StreamedBuildings.Clear();
+		m_PendingBuildings.Clear();
+	}
+
+	static int GetCellCoord(float coord, float cellSize)
+	{
+		return Math.Clamp(Math.Floor(coord / cellSize), 0, CELL_ROW - 1);
+	}
+
+	static int GetCell(vector position, float cellSize)
+	{
+		return GetCellCoord(position[0], cellSize) * CELL_ROW + GetCellCoord(position[2], cellSize);
+	}
 	
 	private void GetIviesPositions(out TVectorArray iviesPosition)
 	{
@@ -237,6 +519,7 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 
 		if ( !m_WhereIviesObjectsSpawn ) {
 			m_WhereIviesObjectsSpawn = new array< ref IviesPosition >;
+			m_IvyGrid = new map<int, ref array<IviesPosition>>;
 			
 			TVectorArray positions = new TVectorArray;
 			GetIviesPositions(positions);
@@ -247,6 +530,36 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 				iviesPosition.radius = 5;
 				
 				m_WhereIviesObjectsSpawn.Insert( iviesPosition );
+				IndexIviesPosition( iviesPosition );
+			}
+		}
+	}
+
+	//! Index ivy region in every cell it overlaps
+	protected void IndexIviesPosition(IviesPosition iviesPosition)
+	{
+		vector position = iviesPosition.position;
+		float radius = iviesPosition.radius;
+
+		int minX = GetCellCoord(position[0] - radius, IVY_CELL_SIZE);
+		int maxX = GetCellCoord(position[0] + radius, IVY_CELL_SIZE);
+		int minZ = GetCellCoord(position[2] - radius, IVY_CELL_SIZE);
+		int maxZ = GetCellCoord(position[2] + radius, IVY_CELL_SIZE);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				int cell = x * CELL_ROW + z;
+
+				array<IviesPosition> cellIvies = m_IvyGrid[cell];
+				if (!cellIvies)
+				{
+					cellIvies = new array<IviesPosition>;
+					m_IvyGrid.Insert(cell, cellIvies);
+				}
+
+				cellIvies.Insert(iviesPosition);
 			}
 		}
 	}
@@ -296,11 +609,17 @@ class ExpansionInteriorBuildingModule: CF_ModuleWorld
 #endif
 
 		// If Ivys are disabled in settings, this will be NULL
-		if ( m_WhereIviesObjectsSpawn )
+		if ( m_IvyGrid )
 		{
-			for (int i = 0; i < m_WhereIviesObjectsSpawn.Count(); i++)
-				if (vector.Distance(m_WhereIviesObjectsSpawn[i].position, position) <= m_WhereIviesObjectsSpawn[i].radius)
-					return true;
+			array<IviesPosition> cellIvies = m_IvyGrid[GetCell(position, IVY_CELL_SIZE)];
+			if (cellIvies)
+			{
+				foreach (IviesPosition iviesPosition: cellIvies)
+				{
+					if (vector.DistanceSq(iviesPosition.position, position) <= iviesPosition.radius * iviesPosition.radius)
+						return true;
+				}
+			}
 		}
 		
 		return false;
@@ -16,7 +16,11 @@ modded class BuildingBase
 	static autoptr array<BuildingBase> m_AllBuldingsInteriors = new array<BuildingBase>;
 	
 	protected static ExpansionInteriorBuildingModule s_InteriorModule;
-	static int s_Expansion_LoadCustomObjectsDelay;
+
+	//! ExpansionInteriorBuildingModule
+	int m_Expansion_StreamIndex = -1;
+	int m_Expansion_StreamCell = -1;
+	bool m_Expansion_IsStreamed;
 	
 	autoptr array<Object> m_InteriorObjects = {};
 	autoptr array<Object> m_IvyObjects = {};
@@ -33,7 +37,11 @@ modded class BuildingBase
 		auto trace = EXTrace.Start(ExpansionTracing.MAPPING, this, GetType());
 #endif
 
-		ExpansionSettings.SI_General.Insert( OnSettingsUpdated );
+		if (!HasInterior() && !HasIvys())
+			return;
+
+		//! Settings updates and client streaming are handled by the module
+		ExpansionInteriorBuildingModule.RegisterBuilding(this);
 
 #ifdef SERVER
 		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Call(OnSettingsUpdated);
@@ -49,47 +57,44 @@ modded class BuildingBase
 		auto trace = EXTrace.Start(ExpansionTracing.MAPPING, this, GetType());
 #endif
 
-		ExpansionSettings.SI_General.Remove( OnSettingsUpdated );
+		ExpansionInteriorBuildingModule.UnregisterBuilding(this);
 	}
 	
 	// ------------------------------------------------------------
 	// OnSettingsUpdated
 	// ------------------------------------------------------------
+	//! Server only, client streams custom objects in through ExpansionInteriorBuildingModule
 	void OnSettingsUpdated()
 	{
 #ifdef EXPANSIONTRACE
 		auto trace = EXTrace.Start(ExpansionTracing.MAPPING, this);
 #endif
+
+		bool loadInterior;
+		int loadIvys;
+		if (Expansion_GetCustomObjectsToLoad(loadInterior, loadIvys))
+			LoadCustomObjects(loadInterior, loadIvys);
+	}
+
+	//! @return false if there is nothing to load according to current settings
+	bool Expansion_GetCustomObjectsToLoad(out bool loadInterior, out int loadIvys)
+	{
 		if (!HasInterior() && !HasIvys())
-			return;
+			return false;
 
 		if (ExpansionWorldObjectsModule.s_RemovedObjects[this])
-			return;
+			return false;
 
 		auto mapping = GetExpansionSettings().GetGeneral().Mapping;
 
-		bool loadInterior;
 		if (HasInterior() && mapping.BuildingInteriors && ExpansionStatic.IsAnyOf(this, mapping.Interiors, false))
 			loadInterior = true;
-		int loadIvys = mapping.BuildingIvys;
+		loadIvys = mapping.BuildingIvys;
 
 		if (!loadInterior && loadIvys == 0)
-			return;
-
-		if (GetGame().IsDedicatedServer())
-		{
-			LoadCustomObjects(loadInterior, loadIvys);
-		}
-		else
-		{
-			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(LoadCustomObjects, s_Expansion_LoadCustomObjectsDelay, false, loadInterior, loadIvys);
+			return false;
 
-			//! @note buildings are initialized map-wide even on client (unlike other entities)
-			//! Load objects every 5 ms to avoid bogging down client
-			s_Expansion_LoadCustomObjectsDelay += 5;
-			if (ExpansionMath.Cmp(s_Expansion_LoadCustomObjectsDelay, 0) == -1)
-				s_Expansion_LoadCustomObjectsDelay = 1000;
-		}
+		return true;
 	}
 
 	override bool EEOnDamageCalculated(TotalDamageResult damageResult, int damageType, EntityAI source, int component, string dmgZone, string ammo, vector modelPos, float speedCoef)
@@ -0,0 +1,355 @@
+/**
+ * ExpansionRespawnCooldownStore.c
+ *
+ * DayZ Expansion Mod
+ * www.dayzexpansion.com
+ * © 2022 DayZ Expansion Mod Team
+ *
+ * This work is licensed under the Creative Commons Attribution-NonCommercial-NoDerivatives 4.0 International License.
+ * To view a copy of this license, visit http://creativecommons.org/licenses/by-nc-nd/4.0/.
+ *
+*/
+
+class ExpansionRespawnCooldownExpiry
+{
+	string m_UID;
+	int m_Index;
+	int m_Timestamp;  //! Timestamp of the timer when this entry was added, entries of since refreshed timers are skipped
+	int m_Expiry;
+
+	void ExpansionRespawnCooldownExpiry(string uid, int index, int timestamp, int expiry)
+	{
+		m_UID = uid;
+		m_Index = index;
+		m_Timestamp = timestamp;
+		m_Expiry = expiry;
+	}
+}
+
+class ExpansionRespawnCooldownPending
+{
+	string m_UID;
+	int m_Index;
+
+	void ExpansionRespawnCooldownPending(string uid, int index)
+	{
+		m_UID = uid;
+		m_Index = index;
+	}
+}
+
+/**@class		ExpansionRespawnCooldownStore
+ * @brief		Server side, persists the respawn cooldowns of all players in one append-only journal
+ *
+ * The cooldown maps of ExpansionRespawnHandlerModule are the in-memory index, the whole journal is only read once on mission start.
+ * Changed cooldowns are queued once per UID and index and appended as one record (UID, timer, last spawn location) each on Flush,
+ * later records replace earlier ones.
+ * Expired cooldowns are removed in expiry order from a min-heap, and the journal is rewritten with only the remaining cooldowns
+ * once it holds more than COMPACT_RATIO times as many records.
+ * Queued changes are flushed to the journal before the rewrite, which goes to a temporary file that only replaces the journal once
+ * it is complete. If a crash leaves the temporary file behind, it is replayed before the journal on the next load. The journal then
+ * either still holds every record up to the rewrite or is an incomplete copy of the temporary file, so replaying it last never
+ * restores an older record over a newer one.
+ **/
+class ExpansionRespawnCooldownStore
+{
+	static const int COMPACT_MIN_RECORDS = 256;
+	static const int COMPACT_RATIO = 2;
+
+	protected string m_FileName;
+	protected map<string, ref map<int, ref ExpansionRespawnDelayTimer>> m_Cooldowns;
+	protected map<string, ref ExpansionLastPlayerSpawnLocation> m_LastIndex;
+
+	protected ref array<ref ExpansionRespawnCooldownExpiry> m_Expiries;  //! Min-heap by expiry
+	protected ref map<string, ref ExpansionRespawnCooldownPending> m_Pending;  //! Keyed by UID and index
+	protected int m_JournalRecords;
+
+	void ExpansionRespawnCooldownStore(string fileName, map<string, ref map<int, ref ExpansionRespawnDelayTimer>> cooldowns, map<string, ref ExpansionLastPlayerSpawnLocation> lastIndex)
+	{
+		m_FileName = fileName;
+		m_Cooldowns = cooldowns;
+		m_LastIndex = lastIndex;
+
+		m_Expiries = new array<ref ExpansionRespawnCooldownExpiry>;
+		m_Pending = new map<string, ref ExpansionRespawnCooldownPending>;
+	}
+
+	void Load()
+	{
+		auto trace = EXTrace.Start(ExpansionTracing.RESPAWN, this);
+
+		//! Temporary file left behind by an interrupted compaction first, records appended to the journal since are newer
+		Replay(GetTempFileName());
+		Replay(m_FileName);
+
+		foreach (string playerUID, map<int, ref ExpansionRespawnDelayTimer> playerTimers: m_Cooldowns)
+		{
+			foreach (int index, ExpansionRespawnDelayTimer playerTimer: playerTimers)
+			{
+				AddExpiry(playerUID, playerTimer);
+			}
+		}
+
+		RemoveExpired();
+		Compact();
+	}
+
+	protected void Replay(string fileName)
+	{
+		if (!FileExist(fileName))
+			return;
+
+		FileSerializer file = new FileSerializer;
+		if (!file.Open(fileName, FileMode.READ))
+			return;
+
+		string uid;
+		while (file.Read(uid))
+		{
+			//! Need new instances for every record
+			ExpansionRespawnDelayTimer timer = null;
+			ExpansionLastPlayerSpawnLocation last = null;
+
+			if (!file.Read(timer))
+				break;
+
+			file.Read(last);
+
+			m_JournalRecords++;
+
+			if (!timer)
+				continue;
+
+			map<int, ref ExpansionRespawnDelayTimer> timers = m_Cooldowns[uid];
+			if (!timers)
+			{
+				timers = new map<int, ref ExpansionRespawnDelayTimer>;
+				m_Cooldowns.Insert(uid, timers);
+			}
+
+			timers.Set(timer.Index, timer);
+
+			if (last)
+				m_LastIndex.Set(uid, last);
+		}
+
+		file.Close();
+	}
+
+	//! Call after a cooldown was added or its timer changed
+	void Set(string uid, int index)
+	{
+		map<int, ref ExpansionRespawnDelayTimer> timers = m_Cooldowns[uid];
+		if (!timers || !timers[index])
+			return;
+
+		AddExpiry(uid, timers[index]);
+
+		string key = uid + ":" + index;
+		if (!m_Pending.Contains(key))
+			m_Pending.Insert(key, new ExpansionRespawnCooldownPending(uid, index));
+	}
+
+	//! Remove expired cooldowns, append queued changes to the journal and compact it if needed
+	void Update()
+	{
+		RemoveExpired();
+
+		if (m_JournalRecords + m_Pending.Count() > COMPACT_MIN_RECORDS && m_JournalRecords + m_Pending.Count() > GetCount() * COMPACT_RATIO)
+			Compact();
+		else
+			Flush();
+	}
+
+	void Flush()
+	{
+		if (!m_Pending.Count())
+			return;
+
+		auto trace = EXTrace.Start(ExpansionTracing.RESPAWN, this);
+
+		FileSerializer file = new FileSerializer;
+		if (!file.Open(m_FileName, FileMode.APPEND))
+			return;
+
+		foreach (string key, ExpansionRespawnCooldownPending pending: m_Pending)
+		{
+			map<int, ref ExpansionRespawnDelayTimer> timers = m_Cooldowns[pending.m_UID];
+			if (!timers || !timers[pending.m_Index])
+				continue;
+
+			file.Write(pending.m_UID);
+			file.Write(timers[pending.m_Index]);
+			file.Write(m_LastIndex[pending.m_UID]);
+
+			m_JournalRecords++;
+		}
+
+		file.Close();
+
+		m_Pending.Clear();
+	}
+
+	//! Rewrite the journal with one record per cooldown
+	void Compact()
+	{
+		auto trace = EXTrace.Start(ExpansionTracing.RESPAWN, this);
+
+		//! Journal must hold the latest records in case only the temporary file survives partially
+		Flush();
+
+		string tempFileName = GetTempFileName();
+
+		FileSerializer file = new FileSerializer;
+		if (!file.Open(tempFileName, FileMode.WRITE))
+			return;
+
+		int count;
+
+		foreach (string uid, map<int, ref ExpansionRespawnDelayTimer> timers: m_Cooldowns)
+		{
+			ExpansionLastPlayerSpawnLocation last = m_LastIndex[uid];
+
+			foreach (int index, ExpansionRespawnDelayTimer timer: timers)
+			{
+				file.Write(uid);
+				file.Write(timer);
+				file.Write(last);
+
+				count++;
+			}
+		}
+
+		file.Close();
+
+		//! Keep the temporary file if the journal couldn't be replaced, it is replayed on next load
+		if (FileExist(m_FileName) && !DeleteFile(m_FileName))
+		{
+			EXPrint(this, "ERROR: Could not replace " + m_FileName);
+			return;
+		}
+
+		if (!CopyFile(tempFileName, m_FileName))
+		{
+			EXPrint(this, "ERROR: Could not replace " + m_FileName);
+			m_JournalRecords = 0;
+			return;
+		}
+
+		DeleteFile(tempFileName);
+
+		m_JournalRecords = count;
+	}
+
+	string GetTempFileName()
+	{
+		return m_FileName + ".tmp";
+	}
+
+	int GetCount()
+	{
+		int count;
+
+		foreach (string uid, map<int, ref ExpansionRespawnDelayTimer> timers: m_Cooldowns)
+		{
+			count += timers.Count();
+		}
+
+		return count;
+	}
+
+	//! @return time (UTC timestamp) after which the timer has no effect anymore
+	static int GetExpiry(ExpansionRespawnDelayTimer timer)
+	{
+		auto settings = GetExpansionSettings().GetSpawn();
+
+		int expiry = timer.Timestamp + settings.GetCooldown(timer.IsTerritory) + timer.Punishment;
+
+		//! Timer is still needed to punish respawning at the same point within the timeframe
+		if (settings.PunishMultispawn && timer.Timestamp + settings.PunishTimeframe > expiry)
+			expiry = timer.Timestamp + settings.PunishTimeframe;
+
+		return expiry;
+	}
+
+	protected void RemoveExpired()
+	{
+		int now = CF_Date.Now(true).GetTimestamp();
+
+		while (m_Expiries.Count() && m_Expiries[0].m_Expiry <= now)
+		{
+			string uid = m_Expiries[0].m_UID;
+			int index = m_Expiries[0].m_Index;
+			int timestamp = m_Expiries[0].m_Timestamp;
+
+			PopExpiry();
+
+			map<int, ref ExpansionRespawnDelayTimer> timers = m_Cooldowns[uid];
+			if (!timers)
+				continue;
+
+			ExpansionRespawnDelayTimer timer = timers[index];
+			if (!timer || timer.Timestamp != timestamp)
+				continue;
+
+			//! Settings may have changed since the entry was added
+			if (GetExpiry(timer) > now)
+			{
+				AddExpiry(uid, timer);
+				continue;
+			}
+
+			timers.Remove(index);
+
+			if (!timers.Count())
+			{
+				m_Cooldowns.Remove(uid);
+				m_LastIndex.Remove(uid);
+			}
+		}
+	}
+
+	protected void AddExpiry(string uid, ExpansionRespawnDelayTimer timer)
+	{
+		int i = m_Expiries.Insert(new ExpansionRespawnCooldownExpiry(uid, timer.Index, timer.Timestamp, GetExpiry(timer)));
+
+		while (i > 0)
+		{
+			int parent = (i - 1) / 2;
+			if (m_Expiries[parent].m_Expiry <= m_Expiries[i].m_Expiry)
+				break;
+
+			m_Expiries.SwapItems(i, parent);
+			i = parent;
+		}
+	}
+
+	protected void PopExpiry()
+	{
+		int last = m_Expiries.Count() - 1;
+		m_Expiries.SwapItems(0, last);
+		m_Expiries.Remove(last);
+
+		int count = m_Expiries.Count();
+		int i;
+
+		while (true)
+		{
+			int smallest = i;
+			int left = i * 2 + 1;
+			int right = left + 1;
+
+			if (left < count && m_Expiries[left].m_Expiry < m_Expiries[smallest].m_Expiry)
+				smallest = left;
+
+			if (right < count && m_Expiries[right].m_Expiry < m_Expiries[smallest].m_Expiry)
+				smallest = right;
+
+			if (smallest == i)
+				break;
+
+			m_Expiries.SwapItems(i, smallest);
+			i = smallest;
+		}
+	}
+}
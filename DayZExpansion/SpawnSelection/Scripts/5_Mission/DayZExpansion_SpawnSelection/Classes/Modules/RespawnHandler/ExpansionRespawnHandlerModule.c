@@ -25,6 +25,8 @@ class ExpansionLastPlayerSpawnLocation
 [CF_RegisterModule(ExpansionRespawnHandlerModule)]
 class ExpansionRespawnHandlerModule: CF_ModuleWorld
 {
+	static const int FLUSH_INTERVAL = 10000;  //! ms
+
 	protected string s_Folder;
 	protected string s_CooldownsFolder;
 	protected string s_FileName;
@@ -32,6 +34,8 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 	bool m_SpawnSelected;
 	ref map<string, ref map<int, ref ExpansionRespawnDelayTimer>> m_PlayerRespawnDelays;
 	ref map<string, ref ExpansionLastPlayerSpawnLocation> m_PlayerLastIndex;
+	protected ref ExpansionRespawnCooldownStore m_CooldownStore;  //! Server only
+	protected bool m_SaveQueued;
 
 	// ------------------------------------------------------------
 	// ExpansionRespawnHandlerModule Constructor
@@ -103,7 +107,7 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 		if (!m_PlayerStartStates.Contains(uid))
 		{
 			m_PlayerStartStates.Insert(uid, new ExpansionPlayerState(player));
-			Save();
+			QueueSave();
 		}
 
 		auto rpc = Expansion_CreateRPC("RPC_ShowSpawnMenu");
@@ -472,7 +476,7 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 		state.ApplyTo(player);
 		m_PlayerStartStates.Remove(uid);
 
-		Save();
+		QueueSave();
 
 		//! Remove any sickness player may have gained while in the cold deep
 		player.RemoveAllAgents();
@@ -780,6 +784,13 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 
 		//! Load all states of players that haven't finished spawn select
 		Load();
+
+		m_CooldownStore = new ExpansionRespawnCooldownStore(folder + "cooldowns.journal", m_PlayerRespawnDelays, m_PlayerLastIndex);
+		m_CooldownStore.Load();
+
+		MigrateLegacyCooldowns();
+
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(OnFlushTimer, FLUSH_INTERVAL, true);
 	}
 
 	// ------------------------------------------------------------
@@ -794,8 +805,31 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 		if (!GetGame().IsDedicatedServer())
 			return;
 
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(OnFlushTimer);
+
 		//! Save all states of players that haven't finished spawn select
 		Save();
+
+		if (m_CooldownStore)
+			m_CooldownStore.Compact();
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionRespawnHandlerModule OnFlushTimer
+	// Called on server, writes queued changes so many spawns in a short time (e.g. after a restart) don't each cause file writes
+	// ------------------------------------------------------------
+	protected void OnFlushTimer()
+	{
+		if (m_SaveQueued)
+			Save();
+
+		if (m_CooldownStore)
+			m_CooldownStore.Update();
+	}
+
+	void QueueSave()
+	{
+		m_SaveQueued = true;
 	}
 
 	// ------------------------------------------------------------
@@ -805,6 +839,8 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 	{
 		auto trace = EXTrace.Start(ExpansionTracing.RESPAWN, this);
 
+		m_SaveQueued = false;
+
 		FileSerializer file = new FileSerializer;
 		if (file.Open(s_FileName, FileMode.WRITE))
 		{
@@ -823,36 +859,6 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 		}
 	}
 
-	void SaveCooldowns(string playerUID)
-	{
-		auto trace = EXTrace.Start(ExpansionTracing.RESPAWN, this);
-
-		string cooldownsFile = s_CooldownsFolder + playerUID + ".bin";
-
-		FileSerializer file = new FileSerializer;
-		if (file.Open(cooldownsFile, FileMode.WRITE))
-		{
-			map<int, ref ExpansionRespawnDelayTimer> playerCooldowns = m_PlayerRespawnDelays[playerUID];
-			if (playerCooldowns)
-			{
-				file.Write(playerCooldowns.Count());
-				foreach (int index, ExpansionRespawnDelayTimer playerTimer: playerCooldowns)
-				{
-					file.Write(playerTimer);
-				}
-			}
-			else
-			{
-				file.Write(0);
-			}
-
-			ExpansionLastPlayerSpawnLocation last = m_PlayerLastIndex[playerUID];
-			file.Write(last);
-
-			file.Close();
-		}
-	}
-
 	// ------------------------------------------------------------
 	// ExpansionRespawnHandlerModule Load
 	// ------------------------------------------------------------
@@ -949,7 +955,8 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 			m_PlayerLastIndex.Insert(playerUID, last);
 		}
 
-		SaveCooldowns(playerUID);
+		if (m_CooldownStore)
+			m_CooldownStore.Set(playerUID, index);
 	}
 	
 	// ------------------------------------------------------------
@@ -965,39 +972,7 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 
 		map<int, ref ExpansionRespawnDelayTimer> playerCooldowns = m_PlayerRespawnDelays[playerUID];
 		if (!playerCooldowns)
-		{
 			playerCooldowns = new map<int, ref ExpansionRespawnDelayTimer>;
-			m_PlayerRespawnDelays.Insert(playerUID, playerCooldowns);
-		}
-
-		if (!playerCooldowns.Count())
-		{
-			string cooldownsFile = s_CooldownsFolder + playerUID + ".bin";
-			if (FileExist(cooldownsFile))
-			{
-				FileSerializer file = new FileSerializer;
-				if (file.Open(cooldownsFile, FileMode.READ))
-				{
-					int count;
-					file.Read(count);
-
-					ExpansionRespawnDelayTimer playerTimer;
-					for (int i = 0; i < count; i++)
-					{
-						file.Read(playerTimer);
-						if (playerTimer)
-							playerCooldowns.Insert(playerTimer.Index, playerTimer);
-					}
-
-					ExpansionLastPlayerSpawnLocation last;
-					file.Read(last);
-					if (last)
-						m_PlayerLastIndex.Insert(playerUID, last);
-
-					file.Close();
-				}
-			}
-		}
 		
 		PlayerBase player = PlayerBase.GetPlayerByUID(playerUID);
 		if (!player)
@@ -1017,6 +992,80 @@ class ExpansionRespawnHandlerModule: CF_ModuleWorld
 		rpc.Expansion_Send(true, player.GetIdentity());
 	}
 	
+	// ------------------------------------------------------------
+	// ExpansionRespawnHandlerModule MigrateLegacyCooldowns
+	// Called on server after the journal was loaded
+	// Moves cooldowns from the per player files of older versions into the journal and deletes those files
+	// ------------------------------------------------------------
+	protected void MigrateLegacyCooldowns()
+	{
+		auto trace = EXTrace.Start(ExpansionTracing.RESPAWN, this);
+
+		TStringArray fileNames = ExpansionStatic.FindFilesInLocation(s_CooldownsFolder, ".bin");
+		foreach (string fileName: fileNames)
+		{
+			LoadLegacyCooldowns(fileName.Substring(0, fileName.Length() - 4));
+		}
+	}
+
+	// ------------------------------------------------------------
+	// ExpansionRespawnHandlerModule LoadLegacyCooldowns
+	// Called on server
+	// ------------------------------------------------------------
+	protected void LoadLegacyCooldowns(string playerUID)
+	{
+		if (!m_CooldownStore)
+			return;
+
+		string cooldownsFile = s_CooldownsFolder + playerUID + ".bin";
+		if (!FileExist(cooldownsFile))
+			return;
+
+		//! Journal entries are newer than anything in the legacy file
+		if (m_PlayerRespawnDelays.Contains(playerUID))
+		{
+			DeleteFile(cooldownsFile);
+			return;
+		}
+
+		FileSerializer file = new FileSerializer;
+		if (!file.Open(cooldownsFile, FileMode.READ))
+			return;
+
+		map<int, ref ExpansionRespawnDelayTimer> playerCooldowns = new map<int, ref ExpansionRespawnDelayTimer>;
+
+		int count;
+		file.Read(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			ExpansionRespawnDelayTimer playerTimer = null;
+			file.Read(playerTimer);
+			if (playerTimer)
+				playerCooldowns.Insert(playerTimer.Index, playerTimer);
+		}
+
+		ExpansionLastPlayerSpawnLocation last;
+		file.Read(last);
+
+		file.Close();
+
+		DeleteFile(cooldownsFile);
+
+		if (!playerCooldowns.Count())
+			return;
+
+		m_PlayerRespawnDelays.Insert(playerUID, playerCooldowns);
+
+		if (last)
+			m_PlayerLastIndex.Insert(playerUID, last);
+
+		foreach (int index, ExpansionRespawnDelayTimer timer: playerCooldowns)
+		{
+			m_CooldownStore.Set(playerUID, index);
+		}
+	}
+	
 	// ------------------------------------------------------------
 	// ExpansionRespawnHandlerModule RPC_CheckPlayerCooldowns
 	// Called on client
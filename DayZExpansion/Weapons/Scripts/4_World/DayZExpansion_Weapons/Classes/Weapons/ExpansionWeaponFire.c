@@ -10,8 +10,60 @@
  *
 */
 
+/**@class		ExpansionWeaponBarrelGeometry
+ * @brief		Muzzle and barrel end memory points of a weapon type in model space, looked up once per type
+ **/
+class ExpansionWeaponBarrelGeometry
+{
+	protected static ref map<string, ref ExpansionWeaponBarrelGeometry> s_Cache = new map<string, ref ExpansionWeaponBarrelGeometry>;
+
+	vector m_MuzzlePositionLS;
+	vector m_BarrelEndPositionLS;
+	float m_Length;
+
+	void ExpansionWeaponBarrelGeometry(Weapon_Base weapon)
+	{
+		m_MuzzlePositionLS = weapon.GetSelectionPositionLS("usti hlavne");
+		m_BarrelEndPositionLS = weapon.GetSelectionPositionLS("konec hlavne");
+		m_Length = vector.Distance(m_MuzzlePositionLS, m_BarrelEndPositionLS);
+	}
+
+	static ExpansionWeaponBarrelGeometry Get(Weapon_Base weapon)
+	{
+		string type = weapon.GetType();
+
+		ExpansionWeaponBarrelGeometry geometry = s_Cache[type];
+		if (!geometry)
+		{
+			geometry = new ExpansionWeaponBarrelGeometry(weapon);
+			s_Cache.Insert(type, geometry);
+		}
+
+		return geometry;
+	}
+};
+
+/**@class		ExpansionWeaponFireBase
+ * @brief		Stateless fire handler, one shared instance per type (see Get)
+ **/
 class ExpansionWeaponFireBase
 {
+	protected static ref map<typename, ref ExpansionWeaponFireBase> s_Instances = new map<typename, ref ExpansionWeaponFireBase>;
+
+	static ExpansionWeaponFireBase Get(typename type)
+	{
+		ExpansionWeaponFireBase instance = s_Instances[type];
+		if (!instance)
+		{
+			if (!Class.CastTo(instance, type.Spawn()))
+				return null;
+
+			s_Instances.Insert(type, instance);
+		}
+
+		return instance;
+	}
+
 	void FireServer(Weapon_Base weapon, int muzzleIndex, DayZPlayerImplement player, vector pos, vector dir)
 	{
 	}
@@ -39,19 +91,17 @@ bool ExpansionTryFireWeapon( DayZPlayerImplement player, Weapon_Base weapon, int
 
 	if (!GetGame().IsDedicatedServer())
 	{
-		ExpansionWeaponFireBase fireBase;
-		if ( Class.CastTo( fireBase, firehandle.Spawn() ) )
+		ExpansionWeaponFireBase fireBase = ExpansionWeaponFireBase.Get( firehandle );
+		if ( fireBase )
 		{
-			vector usti_hlavne_position = weapon.GetSelectionPositionLS("usti hlavne");
-			vector konec_hlavne_position = weapon.GetSelectionPositionLS("konec hlavne");
-			float barrel_length = vector.Distance(usti_hlavne_position, konec_hlavne_position);
+			ExpansionWeaponBarrelGeometry barrel = weapon.Expansion_GetBarrelGeometry();
 
-			vector w_usti_hlavne_position = weapon.ModelToWorld(usti_hlavne_position);
-			vector w_konec_hlavne_position = weapon.ModelToWorld(konec_hlavne_position);
+			vector w_usti_hlavne_position = weapon.ModelToWorld(barrel.m_MuzzlePositionLS);
+			vector w_konec_hlavne_position = weapon.ModelToWorld(barrel.m_BarrelEndPositionLS);
 
 			vector direction = vector.Direction(w_konec_hlavne_position, w_usti_hlavne_position).Normalized();
 
-			vector position = weapon.GetFirePosition( player ) + (direction * barrel_length);
+			vector position = weapon.GetFirePosition( player ) + (direction * barrel.m_Length);
 
 			fireBase.FireClient( weapon, muzzleIndex, player, position, direction );
 
@@ -10,84 +10,99 @@
  *
 */
 
-class ExpansionTeargasHelper
+class ExpansionTeargasAreaEffect: ExpansionAreaEffect
 {
+	protected const float RADIUS = 5.0;
+	protected const int MIN_COUGH_INTERVAL = 500;
+	protected const int MAX_COUGH_INTERVAL = 5000;
+
 	protected const float MAX_SHOCK_INFLICTED = -25.0;
 	protected const float MIN_SHOCK_INFLICTED = -20.0;
 
-	protected int m_CoughTimer = 1000;
-	protected bool m_ZoneActive;
+	//! Mask type -> biological protection
+	protected static ref map<string, bool> s_MaskProtection = new map<string, bool>;
 
-	protected EntityAI m_Entity;
+	void ExpansionTeargasAreaEffect(EntityAI entity)
+	{
+		AttachTo(entity);
+		SetSphere(RADIUS);
+		SetTickInterval(MIN_COUGH_INTERVAL, MAX_COUGH_INTERVAL);
+	}
 
-	void ExpansionTeargasHelper( EntityAI entity )
+	override void OnTickPlayer(PlayerBase player)
 	{
-#ifdef EXPANSIONTRACE
-		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "ExpansionTeargasHelper");
-#endif
+		if (IsProtected(player))
+			return;
 
-		m_Entity = entity;
+		player.GetSymptomManager().QueueUpPrimarySymptom(SymptomIDs.SYMPTOM_COUGH);
+		player.GiveShock(Math.RandomFloatInclusive(MAX_SHOCK_INFLICTED, MIN_SHOCK_INFLICTED));
 	}
 
-	void OnWorkStart()
+	protected bool IsProtected(notnull Man player)
 	{
 #ifdef EXPANSIONTRACE
-		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "OnWorkStart");
+		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "IsProtected");
 #endif
 
-		if ( GetGame().IsServer() )
+		EntityAI mask = player.GetInventory().FindAttachment(InventorySlots.MASK);
+		if (!mask) return false;
+
+		string type = mask.GetType();
+
+		bool isProtected;
+		if (!s_MaskProtection.Find(type, isProtected))
 		{
-			m_ZoneActive = true;
-			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(MakePlayerCough, 2000, false);
+			isProtected = GetGame().ConfigGetInt("CfgVehicles " + type + " Protection biological");
+			s_MaskProtection.Insert(type, isProtected);
 		}
+
+		return isProtected;
 	}
+};
+
+class ExpansionTeargasHelper
+{
+	protected const int START_DELAY = 2000;
 
-	protected void MakePlayerCough()
+	protected EntityAI m_Entity;
+	protected ExpansionTeargasAreaEffect m_Effect;
+
+	void ExpansionTeargasHelper( EntityAI entity )
 	{
 #ifdef EXPANSIONTRACE
-		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "MakePlayerCough");
+		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "ExpansionTeargasHelper");
 #endif
 
-		m_CoughTimer = Math.RandomIntInclusive(500, 5000);
-		array<Object> nearest_objects = new array<Object>();
-		array<CargoBase> proxy_cargos = new array<CargoBase>();
-
-		GetGame().GetObjectsAtPosition3D(m_Entity.GetPosition(), 5, nearest_objects, proxy_cargos);
-
-		for (int i = 0; i < nearest_objects.Count(); i++)
-		{
-			Object nearest_object = nearest_objects.Get(i);
-			if (nearest_object.IsInherited(PlayerBase))
-			{
-				PlayerBase player = PlayerBase.Cast(nearest_object);
-				if (player && !IsProtected(player))
-				{
-					player.GetSymptomManager().QueueUpPrimarySymptom(SymptomIDs.SYMPTOM_COUGH);
-					player.GiveShock(Math.RandomFloatInclusive(MAX_SHOCK_INFLICTED, MIN_SHOCK_INFLICTED));
-				}
-			}
-		}
-
-		if (m_ZoneActive)
-			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(MakePlayerCough, m_CoughTimer, false);
+		m_Entity = entity;
+	}
 
+	void ~ExpansionTeargasHelper()
+	{
+		OnWorkStop();
 	}
 
-	protected bool IsProtected(notnull Man player)
+	void OnWorkStart()
 	{
 #ifdef EXPANSIONTRACE
-		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "IsProtected");
+		auto trace = CF_Trace_0(ExpansionTracing.WEAPONS, this, "OnWorkStart");
 #endif
 
-		EntityAI mask = player.GetInventory().FindAttachment(InventorySlots.MASK);
-		if (!mask) return false;
+		if ( GetGame().IsServer() && !m_Effect )
+		{
+			//! Owned by the manager
+			auto effect = new ExpansionTeargasAreaEffect(m_Entity);
+			ExpansionAreaEffectManager.Register(effect, START_DELAY);
 
-		string protectionPath = "CfgVehicles " + mask.GetType() + " Protection ";
-		return GetGame().ConfigGetInt(protectionPath + "biological");
+			m_Effect = effect;
+		}
 	}
 
 	void OnWorkStop()
 	{
-		m_ZoneActive = false;
+		if (m_Effect)
+		{
+			ExpansionAreaEffectManager.Unregister(m_Effect);
+			m_Effect = null;
+		}
 	}
 };
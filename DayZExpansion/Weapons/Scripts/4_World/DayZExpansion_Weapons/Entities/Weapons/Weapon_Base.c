@@ -16,6 +16,8 @@ modded class Weapon_Base
 
 	private int m_ExShouldFire;
 	private autoptr array< int > m_ExMuzzleIndices;
+
+	protected ExpansionWeaponBarrelGeometry m_Expansion_BarrelGeometry;  //! Shared per type, owned by cache
 	
 	void Weapon_Base()
 	{
@@ -78,11 +80,17 @@ modded class Weapon_Base
 		}
 	}
 
+	ExpansionWeaponBarrelGeometry Expansion_GetBarrelGeometry()
+	{
+		if ( !m_Expansion_BarrelGeometry )
+			m_Expansion_BarrelGeometry = ExpansionWeaponBarrelGeometry.Get( this );
+
+		return m_Expansion_BarrelGeometry;
+	}
+
 	float CalculateBarrelLength()
 	{
-		vector usti_hlavne_position = GetSelectionPositionLS( "usti hlavne" );
-		vector konec_hlavne_position = GetSelectionPositionLS( "konec hlavne" );
-		return vector.Distance( usti_hlavne_position, konec_hlavne_position );
+		return Expansion_GetBarrelGeometry().m_Length;
 	}
 	
 	void ExpansionSetNextFire( int muzzleIndex )
@@ -113,7 +121,7 @@ modded class Weapon_Base
 
 			vector position = GetFirePosition( player ) + ( direction * CalculateBarrelLength() );
 
-			ExpansionWeaponFireBase fireBase = ExpansionWeaponFireBase.Cast( GetExpansionFireType().Spawn() );
+			ExpansionWeaponFireBase fireBase = ExpansionWeaponFireBase.Get( GetExpansionFireType() );
 
 			if ( fireBase )
 			{